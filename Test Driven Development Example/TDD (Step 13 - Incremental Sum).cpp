@@ -0,0 +1,476 @@
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <memory>
+#include <random>
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//13.
+//Keep the sum of a large string up to date while it is being edited. Inserting, deleting or replacing a range of characters
+//should only read the part of the string around the edit, even when numbers or delimiters join or split at its edges
+// - Added DelimSpec, ParseDelimSpec() and ParseTokenValue() from Step 12
+//	 Added IncrementalSum. The string is split into chunks that always end right after a delimiter, so each chunk can be summed
+//	 on its own. An edit rescans from the chunk before it until the scan lines up with an old chunk boundary again
+//	 The chunks keep their own text in a treap (a balanced tree with random priorities) that also holds the length, sum and negatives
+//	 under each node, so finding the chunk at an offset and replacing chunks takes log(chunk count) steps
+//	 Editing the delimiter declarations (or the first character) rescans everything
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+struct DelimSpec {
+	bool usingDelim = false;	//false means any non digit splits numbers
+	std::vector<std::string> delimiters;
+	size_t bodyStart = 0;	//offset of the first character after the delimiter declarations
+};
+
+DelimSpec ParseDelimSpec(const char* numbers, size_t size) {	//reads the delimiters the same way as the top of Add()
+	DelimSpec spec;
+	if (size == 0 || isdigit(numbers[0])) return spec;
+
+	spec.usingDelim = true;
+	spec.delimiters.push_back("");
+	size_t i = 0;
+	for (; i < size; ++i) {
+		if (numbers[i] == '[') continue;
+		if (numbers[i] == ']') {
+			if ((i + 1) < size && numbers[i + 1] != '[') {
+				++i;
+				break;
+			}
+			spec.delimiters.push_back("");
+			continue;
+		}
+		spec.delimiters[spec.delimiters.size() - 1] += numbers[i];
+	}
+	spec.bodyStart = i;
+	return spec;
+}
+
+DelimSpec ParseDelimSpec(const std::string& numbers) {
+	return ParseDelimSpec(numbers.data(), numbers.size());
+}
+
+int ParseTokenValue(const char* first, const char* last) {	//same result as reading an int from a stringstream, without the copy
+	while (first != last && (*first == ' ' || (*first >= '\t' && *first <= '\r'))) ++first;	//stringstream skips leading whitespace
+	bool negative = false;
+	if (first != last && (*first == '-' || *first == '+')) negative = *first++ == '-';
+	long long value = 0;
+	for (; first != last && *first >= '0' && *first <= '9'; ++first) {
+		value = value * 10 + (*first - '0');
+		if (value > 1LL + INT_MAX) value = 1LL + INT_MAX;	//out of range, stringstream gives back INT_MAX or INT_MIN
+	}
+	if (negative) return value > INT_MAX ? INT_MIN : int(-value);
+	return value > INT_MAX ? INT_MAX : int(value);
+}
+
+class IncrementalSum {
+public:
+	explicit IncrementalSum(const std::string& numbers = "", size_t chunkSize = 4096) :chunkSize(chunkSize ? chunkSize : 1) {
+		Rebuild(numbers);
+	}
+
+	//Replaces length characters at offset with replacement. Insert and Erase are the two special cases
+	void Replace(size_t offset, size_t length, const std::string& replacement) {
+		size_t size = Size();
+		if (offset > size) offset = size;
+		if (length > size - offset) length = size - offset;
+		if (offset <= header.size()) {	//delimiters (or the first character when there are none) changed, read it all again
+			std::string text = Text();
+			text.replace(offset, length, replacement);
+			Rebuild(text);
+			return;
+		}
+
+		//delimiters are checked up to maxDelim - 1 characters ahead, so a chunk ending that close to the edit may have ended differently
+		size_t body = offset - header.size();
+		size_t lookBack = std::min(body, maxDelim - 1);
+		Tree before, after;
+		SplitBytes(std::move(root), body - lookBack, before, after);	//after starts with the chunk the scan starts from
+		size_t editStart = body - Length(before.get());
+
+		Rescan rescan(std::move(after));
+		while (rescan.after && rescan.window.size() < editStart + length) rescan.Pull();	//the old chunks the edit touches
+		rescan.window.replace(editStart, length, replacement);
+		for (size_t& end : rescan.ends) end = end >= editStart + length ? end - length + replacement.size() : 0;	//0 is never a place to stop
+		Tree rescanned = Scan(rescan, editStart + replacement.size());
+		root = Merge(Merge(std::move(before), std::move(rescanned)), std::move(rescan.after));
+	}
+
+	void Insert(size_t offset, const std::string& inserted) { Replace(offset, 0, inserted); }
+	void Erase(size_t offset, size_t length) { Replace(offset, length, ""); }
+
+	long long Sum() const {	//same result as Add(Text())
+		if (root && root->negatives) throw NegativeNumberException(FirstNegative(root.get()));
+		return root ? root->sum : 0;
+	}
+
+	std::string Text() const {	//puts the whole string together, so it costs as much as its length
+		std::string text = header;
+		Append(root.get(), text);
+		return text;
+	}
+
+	size_t Size() const { return header.size() + Length(root.get()); }
+	size_t ChunkCount() const { return root ? root->count : 0; }
+	size_t LastScanned() const { return lastScanned; }	//characters the last edit read again
+
+private:
+	struct Node;
+	typedef std::unique_ptr<Node> Tree;
+
+	struct Node {	//one chunk in a treap ordered by position, with the totals of everything under it
+		std::string text;
+		long long chunkSum = 0;
+		size_t chunkNegatives = 0;
+		int firstNegative = 0;
+		unsigned priority = 0;
+		Tree left, right;
+		size_t length = 0, count = 0, negatives = 0;
+		long long sum = 0;
+	};
+
+	struct Rescan {	//the text being read again, made of old chunks taken off the front of after as they are needed
+		explicit Rescan(Tree after) :after(std::move(after)) {}
+
+		void Pull() {
+			Tree chunk = PopFront(after);
+			window += chunk->text;
+			ends.push_back(window.size());
+			pulled.push_back(std::move(chunk));
+		}
+
+		std::string window;
+		std::vector<Tree> pulled;
+		std::vector<size_t> ends;	//where each pulled chunk ends in window
+		Tree after;
+	};
+
+	static size_t Length(const Node* node) { return node ? node->length : 0; }
+
+	static void Update(Node* node) {
+		node->length = node->text.size();
+		node->count = 1;
+		node->sum = node->chunkSum;
+		node->negatives = node->chunkNegatives;
+		for (const Node* child : { node->left.get(), node->right.get() }) {
+			if (!child) continue;
+			node->length += child->length;
+			node->count += child->count;
+			node->sum += child->sum;
+			node->negatives += child->negatives;
+		}
+	}
+
+	static Tree Merge(Tree left, Tree right) {	//every chunk of left comes before every chunk of right
+		if (!left) return right;
+		if (!right) return left;
+		if (left->priority > right->priority) {
+			left->right = Merge(std::move(left->right), std::move(right));
+			Update(left.get());
+			return left;
+		}
+		right->left = Merge(std::move(left), std::move(right->left));
+		Update(right.get());
+		return right;
+	}
+
+	//left gets the chunks that end before offset. The last chunk can end in the middle of a number, so one ending right at offset isn't
+	//a safe place to start reading from
+	static void SplitBytes(Tree tree, size_t offset, Tree& left, Tree& right) {
+		if (!tree) {
+			left.reset();
+			right.reset();
+			return;
+		}
+		size_t leftLength = Length(tree->left.get());
+		if (leftLength + tree->text.size() < offset) {
+			Tree rest;
+			SplitBytes(std::move(tree->right), offset - leftLength - tree->text.size(), rest, right);
+			tree->right = std::move(rest);
+			Update(tree.get());
+			left = std::move(tree);
+		}
+		else {
+			Tree rest;
+			SplitBytes(std::move(tree->left), offset, left, rest);
+			tree->left = std::move(rest);
+			Update(tree.get());
+			right = std::move(tree);
+		}
+	}
+
+	static Tree PopFront(Tree& tree) {
+		if (tree->left) {
+			Tree first = PopFront(tree->left);
+			Update(tree.get());
+			return first;
+		}
+		Tree first = std::move(tree);
+		tree = std::move(first->right);
+		Update(first.get());
+		return first;
+	}
+
+	static int FirstNegative(const Node* node) {	//only called when node has one
+		for (;;) {
+			if (node->left && node->left->negatives) node = node->left.get();
+			else if (node->chunkNegatives) return node->firstNegative;
+			else node = node->right.get();
+		}
+	}
+
+	static void Append(const Node* node, std::string& text) {
+		if (!node) return;
+		Append(node->left.get(), text);
+		text += node->text;
+		Append(node->right.get(), text);
+	}
+
+	void Rebuild(const std::string& text) {
+		spec = ParseDelimSpec(text);
+		header = text.substr(0, spec.bodyStart);
+		maxDelim = 1;
+		for (const std::string& delim : spec.delimiters) maxDelim = std::max(maxDelim, delim.size());
+		Rescan rescan(nullptr);
+		rescan.window = text.substr(spec.bodyStart);
+		root = Scan(rescan, 0);
+	}
+
+	size_t DelimAt(const std::string& text, size_t i) const {	//length of the delimiter found at i, 0 if i is part of a number
+		if (!spec.usingDelim) return isdigit(text[i]) ? 0 : 1;
+		for (const std::string& delim : spec.delimiters) {
+			if (delim.empty() || text[i] != delim.front() || text.size() - i < delim.size()) continue;
+			if (std::memcmp(text.data() + i, delim.data(), delim.size()) == 0) return delim.size();
+		}
+		return 0;
+	}
+
+	//Reads rescan.window from its start, which has to be between numbers, and gives back its chunks. It stops after a delimiter at or
+	//past editEnd where an old chunk ended, as the old chunks are still right from there on, and puts back the ones it didn't need
+	Tree Scan(Rescan& rescan, size_t editEnd) {
+		const std::string& window = rescan.window;
+		Tree chunks;
+		Node chunk;
+		size_t chunkStart = 0, position = 0, next = 0;
+		size_t tokenStart = std::string::npos;
+		auto emit = [&](size_t end) {
+			Tree node(new Node());
+			node->text = window.substr(chunkStart, end - chunkStart);
+			node->chunkSum = chunk.chunkSum;
+			node->chunkNegatives = chunk.chunkNegatives;
+			node->firstNegative = chunk.firstNegative;
+			node->priority = unsigned(priorities());
+			Update(node.get());
+			chunks = Merge(std::move(chunks), std::move(node));
+			chunk = Node();
+			chunkStart = end;
+		};
+
+		for (;;) {
+			while (rescan.after && window.size() < position + maxDelim) rescan.Pull();	//a delimiter may run into the next chunk
+			if (position >= window.size()) break;
+			size_t length = DelimAt(window, position);
+			if (!length) {
+				if (tokenStart == std::string::npos) tokenStart = position;
+				++position;
+				continue;
+			}
+			if (tokenStart != std::string::npos) {
+				AddToken(chunk, window, tokenStart, position);
+				tokenStart = std::string::npos;
+			}
+			position += length;
+			while (next < rescan.ends.size() && rescan.ends[next] < position) ++next;
+			if (position >= editEnd && next < rescan.ends.size() && rescan.ends[next] == position) {
+				for (size_t i = rescan.pulled.size(); i-- > next + 1;) rescan.after = Merge(std::move(rescan.pulled[i]), std::move(rescan.after));
+				break;
+			}
+			if (position - chunkStart >= chunkSize) emit(position);
+		}
+		if (tokenStart != std::string::npos) AddToken(chunk, window, tokenStart, position);
+		if (position > chunkStart) emit(position);
+		lastScanned = position;
+		return chunks;
+	}
+
+	static void AddToken(Node& chunk, const std::string& text, size_t first, size_t last) {
+		int value = ParseTokenValue(text.data() + first, text.data() + last);
+		if (value < 0) {
+			if (!chunk.chunkNegatives++) chunk.firstNegative = value;
+		}
+		else if (value <= 1000) chunk.chunkSum += value;
+	}
+
+	size_t chunkSize;
+	DelimSpec spec;
+	std::string header;	//the delimiter declarations, everything before the body
+	size_t maxDelim = 1;
+	Tree root;	//the body, from spec.bodyStart to the end
+	std::mt19937 priorities;
+	size_t lastScanned = 0;
+};
+
+int main()
+{
+	try{
+
+		std::cout << "Accepts the following syntax:\n**\nstring-of-numbers\n**\n[delimiter]\n[more delimiters...]\nstring-of-numbers\n**\n";
+		IncrementalSum document("[,,][..]1..2,,3");
+		std::cout << document.Sum() << '\n';
+		document.Insert(15, "..10");
+		std::cout << document.Sum() << '\n';
+		document.Erase(13, 1);
+		std::cout << document.Sum() << '\n';
+		document.Replace(8, 1, "7");
+		std::cout << document.Sum() << '\n';
+		document.Insert(8, "-");
+		std::cout << document.Sum() << '\n';
+
+		//Expected output:
+		//6. evaluates to 1 + 2 + 3
+		//16. 10 is added after the last number
+		//13. removing a comma joins 2 and 3 into "2,3", which converts to 2
+		//19. 1 is replaced with 7
+		//Exception. Negative number
+	}
+	catch (std::exception& e) {
+		std::cerr << "Exception: " << e.what() << '\n';
+	}
+	system("pause");	//prevent cmd window from closing on windows
+    return 0;
+}
\ No newline at end of file
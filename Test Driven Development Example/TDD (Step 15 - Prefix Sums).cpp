@@ -0,0 +1,428 @@
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <thread>
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//15.
+//Give back the running total after every accepted number, not just the final result. Write them to a buffer supplied by the caller
+//or hand them out as they are worked out. Use a vectorized prefix scan, and split large inputs across threads
+// - Added DelimSpec, ParseDelimSpec(), ParseTokenValue() and the token range from Step 12 to read the numbers without copying
+//	 Added InclusiveScan(), a prefix sum using SSE2 when it is available, and ParallelInclusiveScan() which sums blocks on separate
+//	 threads first and then scans each block starting from the total of the blocks before it
+//	 Added PrefixSums() for a caller's buffer and StreamPrefixSums() which hands out the totals a block at a time
+//	 The totals are 64 bit, as past about 2.1 million numbers of 1000 they no longer fit in an int
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TDD_SSE2
+#include <emmintrin.h>
+#endif
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+struct DelimSpec {
+	bool usingDelim = false;	//false means any non digit splits numbers
+	std::vector<std::string> delimiters;
+	size_t bodyStart = 0;	//offset of the first character after the delimiter declarations
+};
+
+DelimSpec ParseDelimSpec(const char* numbers, size_t size) {	//reads the delimiters the same way as the top of Add()
+	DelimSpec spec;
+	if (size == 0 || isdigit(numbers[0])) return spec;
+
+	spec.usingDelim = true;
+	spec.delimiters.push_back("");
+	size_t i = 0;
+	for (; i < size; ++i) {
+		if (numbers[i] == '[') continue;
+		if (numbers[i] == ']') {
+			if ((i + 1) < size && numbers[i + 1] != '[') {
+				++i;
+				break;
+			}
+			spec.delimiters.push_back("");
+			continue;
+		}
+		spec.delimiters[spec.delimiters.size() - 1] += numbers[i];
+	}
+	spec.bodyStart = i;
+	return spec;
+}
+
+DelimSpec ParseDelimSpec(const std::string& numbers) {
+	return ParseDelimSpec(numbers.data(), numbers.size());
+}
+
+int ParseTokenValue(const char* first, const char* last) {	//same result as reading an int from a stringstream, without the copy
+	while (first != last && (*first == ' ' || (*first >= '\t' && *first <= '\r'))) ++first;	//stringstream skips leading whitespace
+	bool negative = false;
+	if (first != last && (*first == '-' || *first == '+')) negative = *first++ == '-';
+	long long value = 0;
+	for (; first != last && *first >= '0' && *first <= '9'; ++first) {
+		value = value * 10 + (*first - '0');
+		if (value > 1LL + INT_MAX) value = 1LL + INT_MAX;	//out of range, stringstream gives back INT_MAX or INT_MIN
+	}
+	if (negative) return value > INT_MAX ? INT_MIN : int(-value);
+	return value > INT_MAX ? INT_MAX : int(value);
+}
+
+struct Token {
+	int value;	//converted without the Step 5 and 6 rules, so negatives and numbers over 1000 come through as they are
+	size_t offset;
+	size_t length;
+};
+
+class TokenIterator {
+public:
+	using iterator_category = std::input_iterator_tag;
+	using iterator_concept = std::forward_iterator_tag;
+	using value_type = Token;
+	using difference_type = std::ptrdiff_t;
+	using pointer = void;
+	using reference = Token;
+
+	TokenIterator() = default;
+	TokenIterator(const char* data, size_t size, const DelimSpec* spec) :data(data), size(size), spec(spec), position(spec->bodyStart), atEnd(false) {
+		Next();
+	}
+
+	Token operator*() const { return current; }
+	TokenIterator& operator++() { Next(); return *this; }
+	TokenIterator operator++(int) { TokenIterator before = *this; Next(); return before; }
+
+	bool operator==(const TokenIterator& other) const {
+		return atEnd == other.atEnd && (atEnd || current.offset == other.current.offset);
+	}
+	bool operator!=(const TokenIterator& other) const { return !(*this == other); }
+
+private:
+	size_t DelimAt(size_t i) const {	//length of the delimiter found at i, 0 if i is part of a number
+		if (!spec->usingDelim) return (data[i] >= '0' && data[i] <= '9') ? 0 : 1;
+		for (const std::string& delim : spec->delimiters) {
+			if (delim.empty() || data[i] != delim.front() || size - i < delim.size()) continue;
+			if (std::memcmp(data + i, delim.data(), delim.size()) == 0) return delim.size();
+		}
+		return 0;
+	}
+
+	void Next() {
+		size_t length;
+		while (position < size && (length = DelimAt(position)) != 0) position += length;	//skip delimiters until a number starts
+		if (position >= size) {
+			atEnd = true;
+			return;
+		}
+		size_t start = position;
+		while (position < size && DelimAt(position) == 0) ++position;
+		current.offset = start;
+		current.length = position - start;
+		current.value = ParseTokenValue(data + start, data + position);
+	}
+
+	const char* data = nullptr;
+	size_t size = 0;
+	const DelimSpec* spec = nullptr;
+	size_t position = 0;
+	Token current = Token();
+	bool atEnd = true;	//a default constructed iterator is an end iterator
+};
+
+class TokenRange {
+public:
+	TokenRange() = default;
+	TokenRange(const char* data, size_t size, const DelimSpec& spec) :data(data), size(size), spec(&spec) {}
+
+	TokenIterator begin() const { return spec ? TokenIterator(data, size, spec) : TokenIterator(); }
+	TokenIterator end() const { return TokenIterator(); }
+
+private:
+	const char* data = nullptr;
+	size_t size = 0;
+	const DelimSpec* spec = nullptr;
+};
+
+//The range points into input and spec, both have to outlive it
+TokenRange tokens(const char* data, size_t size, const DelimSpec& spec) {
+	return TokenRange(data, size, spec);
+}
+
+TokenRange tokens(const std::string& input, const DelimSpec& spec) {
+	return TokenRange(input.data(), input.size(), spec);
+}
+
+//out[i] = carry + in[0] + ... + in[i], returns the last total
+int64_t InclusiveScan(const int* in, int64_t* out, size_t count, int64_t carry = 0) {
+	size_t i = 0;
+#ifdef TDD_SSE2
+	__m128i running = _mm_set1_epi64x(carry);
+	for (; i + 4 <= count; i += 4) {
+		__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+		__m128i sign = _mm_srai_epi32(x, 31);	//SSE2 has no sign extend, interleave each int with its sign instead
+		__m128i low = _mm_unpacklo_epi32(x, sign), high = _mm_unpackhi_epi32(x, sign);	//a, b and c, d as 64 bit lanes
+		low = _mm_add_epi64(low, _mm_slli_si128(low, 8));	//a, a+b
+		high = _mm_add_epi64(high, _mm_slli_si128(high, 8));	//c, c+d
+		low = _mm_add_epi64(low, running);
+		running = _mm_unpackhi_epi64(low, low);	//carry a+b into c and d
+		high = _mm_add_epi64(high, running);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), low);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 2), high);
+		running = _mm_unpackhi_epi64(high, high);	//carry the last lane into the next four
+	}
+	_mm_storel_epi64(reinterpret_cast<__m128i*>(&carry), running);
+#endif
+	for (; i < count; ++i) out[i] = carry += in[i];
+	return carry;
+}
+
+void ParallelInclusiveScan(const int* in, int64_t* out, size_t count, unsigned threads) {
+	if (threads <= 1 || count < (1 << 16)) {
+		InclusiveScan(in, out, count);
+		return;
+	}
+	size_t block = (count + threads - 1) / threads;
+	std::vector<int64_t> blockTotals(threads, 0);
+	std::vector<std::thread> workers;
+
+	for (unsigned t = 0; t < threads; ++t) {	//first pass, the total of every block
+		workers.emplace_back([&, t]() {
+			size_t first = std::min(count, t * block), last = std::min(count, first + block);
+			int64_t total = 0;
+			for (size_t i = first; i < last; ++i) total += in[i];
+			blockTotals[t] = total;
+		});
+	}
+	for (std::thread& worker : workers) worker.join();
+	workers.clear();
+
+	int64_t carry = 0;
+	for (int64_t& total : blockTotals) {	//exclusive scan of the block totals gives each block its starting carry
+		int64_t blockTotal = total;
+		total = carry;
+		carry += blockTotal;
+	}
+
+	for (unsigned t = 0; t < threads; ++t) {	//second pass, scan every block from its carry
+		workers.emplace_back([&, t]() {
+			size_t first = std::min(count, t * block), last = std::min(count, first + block);
+			InclusiveScan(in + first, out + first, last - first, blockTotals[t]);
+		});
+	}
+	for (std::thread& worker : workers) worker.join();
+}
+
+std::vector<int> AcceptedNumbers(const std::string& numbers) {	//the numbers Add() would sum, in order, throwing on the first negative
+	std::vector<int> accepted;
+	DelimSpec spec = ParseDelimSpec(numbers);
+	for (Token token : tokens(numbers, spec)) {
+		if (token.value < 0) throw NegativeNumberException(token.value);
+		if (token.value <= 1000) accepted.push_back(token.value);
+	}
+	return accepted;
+}
+
+//Writes the running total after each accepted number to out and returns how many there are. Like snprintf, only the first
+//capacity totals are written if out is too small, so calling with capacity 0 asks for the size. The last total equals Add()
+size_t PrefixSums(const std::string& numbers, int64_t* out, size_t capacity, unsigned threads = 1) {
+	std::vector<int> accepted = AcceptedNumbers(numbers);
+	if (capacity >= accepted.size()) ParallelInclusiveScan(accepted.data(), out, accepted.size(), threads);
+	else if (capacity) {
+		std::vector<int64_t> totals(accepted.size());
+		ParallelInclusiveScan(accepted.data(), totals.data(), totals.size(), threads);
+		std::copy(totals.begin(), totals.begin() + capacity, out);
+	}
+	return accepted.size();
+}
+
+//Calls onTotals(totals, count) with the running totals a block at a time, so they never all have to be in memory. Returns the
+//last total, which is Add() as long as it fits in an int
+template <typename F>
+int64_t StreamPrefixSums(const std::string& numbers, F onTotals, size_t blockSize = 4096) {
+	DelimSpec spec = ParseDelimSpec(numbers);
+	std::vector<int> block;
+	std::vector<int64_t> totals(std::max<size_t>(blockSize, 1));
+	block.reserve(totals.size());
+	int64_t carry = 0;
+	for (Token token : tokens(numbers, spec)) {
+		if (token.value < 0) throw NegativeNumberException(token.value);
+		if (token.value > 1000) continue;
+		block.push_back(token.value);
+		if (block.size() == totals.size()) {
+			carry = InclusiveScan(block.data(), totals.data(), block.size(), carry);
+			onTotals(static_cast<const int64_t*>(totals.data()), block.size());
+			block.clear();
+		}
+	}
+	if (block.size()) {
+		carry = InclusiveScan(block.data(), totals.data(), block.size(), carry);
+		onTotals(static_cast<const int64_t*>(totals.data()), block.size());
+	}
+	return carry;
+}
+
+int main()
+{
+	try{
+
+		std::cout << "Accepts the following syntax:\n**\nstring-of-numbers\n**\n[delimiter]\n[more delimiters...]\nstring-of-numbers\n**\n";
+		int64_t totals[8];
+		size_t count = PrefixSums("1 2 3", totals, 8);
+		for (size_t i = 0; i < count; ++i) std::cout << totals[i] << ' ';
+		std::cout << '\n';
+		count = PrefixSums("[\nn][...]1\nn1001|\nn1\n1 ,.(\nn1...1\n", totals, 8);
+		for (size_t i = 0; i < count; ++i) std::cout << totals[i] << ' ';
+		std::cout << '\n';
+		std::cout << PrefixSums("[;]23;/4;;7", totals, 0) << '\n';
+		std::cout << StreamPrefixSums("[,,][..]1..2,,3..4", [](const int64_t* block, size_t size) { std::cout << block[size - 1] << ' '; }, 2) << '\n';
+		PrefixSums("[\n]3\n9\n-1", totals, 8);
+
+		//Expected output:
+		//1 3 6. running totals of 1 + 2 + 3
+		//1 2 3 4. 1001 is ignored so it doesn't get a total
+		//3. asking for the size only, "/4" converts to 0 but is still accepted
+		//3 10 10. the last total of each block of two, then the result
+		//Exception. Negative number
+	}
+	catch (std::exception& e) {
+		std::cerr << "Exception: " << e.what() << '\n';
+	}
+	system("pause");	//prevent cmd window from closing on windows
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,453 @@
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <unordered_set>
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//17.
+//Estimate the sum of a huge file from random chunks of it instead of reading all of it, and say how far off the estimate could be.
+//The caller picks how many bytes to read, or how small the error should be
+// - Added DelimSpec, ParseDelimSpec() and ParseTokenValue() from Step 12 and MappedFile from Step 14
+//	 Added EstimateSum(). Each sampled chunk skips ahead to the end of its first delimiter and sums the numbers up to the first
+//	 delimiter of the next chunk, so the chunks add up to the whole file. The interval comes from the spread of the chunk sums
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+struct DelimSpec {
+	bool usingDelim = false;	//false means any non digit splits numbers
+	std::vector<std::string> delimiters;
+	size_t bodyStart = 0;	//offset of the first character after the delimiter declarations
+};
+
+DelimSpec ParseDelimSpec(const char* numbers, size_t size) {	//reads the delimiters the same way as the top of Add()
+	DelimSpec spec;
+	if (size == 0 || isdigit(numbers[0])) return spec;
+
+	spec.usingDelim = true;
+	spec.delimiters.push_back("");
+	size_t i = 0;
+	for (; i < size; ++i) {
+		if (numbers[i] == '[') continue;
+		if (numbers[i] == ']') {
+			if ((i + 1) < size && numbers[i + 1] != '[') {
+				++i;
+				break;
+			}
+			spec.delimiters.push_back("");
+			continue;
+		}
+		spec.delimiters[spec.delimiters.size() - 1] += numbers[i];
+	}
+	spec.bodyStart = i;
+	return spec;
+}
+
+DelimSpec ParseDelimSpec(const std::string& numbers) {
+	return ParseDelimSpec(numbers.data(), numbers.size());
+}
+
+int ParseTokenValue(const char* first, const char* last) {	//same result as reading an int from a stringstream, without the copy
+	while (first != last && (*first == ' ' || (*first >= '\t' && *first <= '\r'))) ++first;	//stringstream skips leading whitespace
+	bool negative = false;
+	if (first != last && (*first == '-' || *first == '+')) negative = *first++ == '-';
+	long long value = 0;
+	for (; first != last && *first >= '0' && *first <= '9'; ++first) {
+		value = value * 10 + (*first - '0');
+		if (value > 1LL + INT_MAX) value = 1LL + INT_MAX;	//out of range, stringstream gives back INT_MAX or INT_MIN
+	}
+	if (negative) return value > INT_MAX ? INT_MIN : int(-value);
+	return value > INT_MAX ? INT_MAX : int(value);
+}
+
+class MappedFile {	//read only view of a whole file
+public:
+	explicit MappedFile(const std::string& path) {
+#ifdef _WIN32
+		file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+		if (file == INVALID_HANDLE_VALUE) throw std::runtime_error("can't open " + path);
+		LARGE_INTEGER length;
+		GetFileSizeEx(file, &length);
+		size = size_t(length.QuadPart);
+		if (size) {
+			mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+			if (mapping) data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+			if (!data) {
+				Close();
+				throw std::runtime_error("can't map " + path);
+			}
+		}
+#else
+		descriptor = open(path.c_str(), O_RDONLY);
+		if (descriptor < 0) throw std::runtime_error("can't open " + path);
+		struct stat info;
+		fstat(descriptor, &info);
+		size = size_t(info.st_size);
+		if (size) {
+			void* view = mmap(nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0);
+			if (view == MAP_FAILED) {
+				Close();
+				throw std::runtime_error("can't map " + path);
+			}
+			data = static_cast<const char*>(view);
+		}
+#endif
+	}
+
+	~MappedFile() { Close(); }
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	const char* Data() const { return data ? data : ""; }
+	size_t Size() const { return size; }
+
+private:
+	void Close() {
+#ifdef _WIN32
+		if (data) UnmapViewOfFile(data);
+		if (mapping) CloseHandle(mapping);
+		if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+		mapping = NULL;
+		file = INVALID_HANDLE_VALUE;
+#else
+		if (data) munmap(const_cast<char*>(data), size);
+		if (descriptor >= 0) close(descriptor);
+		descriptor = -1;
+#endif
+		data = nullptr;
+	}
+
+	const char* data = nullptr;
+	size_t size = 0;
+#ifdef _WIN32
+	HANDLE file = INVALID_HANDLE_VALUE;
+	HANDLE mapping = NULL;
+#else
+	int descriptor = -1;
+#endif
+};
+
+struct SampleOptions {
+	uint64_t byteBudget = 64 << 20;	//stop after reading about this many bytes
+	double targetError = 0;	//stop once the interval is within this fraction of the estimate, 0 to use the whole budget
+	double confidence = 0.95;	//how likely the real sum is to be inside the interval
+	size_t chunkSize = 64 << 10;
+	uint64_t seed = 1;
+};
+
+struct SampledSum {
+	double estimate = 0;
+	double low = 0;	//interval the real sum is in, with the confidence that was asked for
+	double high = 0;
+	uint64_t bytesRead = 0;
+	uint64_t chunksSampled = 0;
+	uint64_t chunksTotal = 0;
+	bool exact = false;	//every chunk was read so the estimate is the real sum
+};
+
+double ZScore(double confidence) {	//how many standard deviations cover confidence of a normal distribution
+	double low = 0, high = 10;
+	for (int i = 0; i < 64; ++i) {
+		double middle = (low + high) / 2;
+		if (std::erf(middle / std::sqrt(2.0)) < confidence) low = middle;
+		else high = middle;
+	}
+	return (low + high) / 2;
+}
+
+class ChunkSampler {	//sums the numbers that belong to one chunk of the body
+public:
+	ChunkSampler(const char* data, size_t size, size_t chunkSize) :data(data), size(size), chunkSize(chunkSize), spec(ParseDelimSpec(data, size)) {}
+
+	uint64_t ChunkCount() const {
+		uint64_t body = size - spec.bodyStart;
+		return (body + chunkSize - 1) / chunkSize;
+	}
+
+	//A chunk owns the numbers after the end of the first delimiter that starts inside it, up to the same place in the next chunk.
+	//The first chunk starts at the numbers. Returns the sum and adds how many bytes were looked at to bytesRead
+	long long Sum(uint64_t chunk, uint64_t& bytesRead) const {
+		size_t begin = size_t(spec.bodyStart + chunk * chunkSize);
+		return SumRange(begin, std::min(size, begin + chunkSize), chunk != 0, bytesRead);
+	}
+
+	long long SumAll(uint64_t& bytesRead) const {	//one pass over the whole body, same as Add()
+		return SumRange(spec.bodyStart, size, false, bytesRead);
+	}
+
+private:
+	size_t DelimAt(size_t i) const {	//length of the delimiter found at i, 0 if i is part of a number
+		if (!spec.usingDelim) return isdigit(data[i]) ? 0 : 1;
+		for (const std::string& delim : spec.delimiters) {
+			if (delim.empty() || data[i] != delim.front() || size - i < delim.size()) continue;
+			if (std::memcmp(data + i, delim.data(), delim.size()) == 0) return delim.size();
+		}
+		return 0;
+	}
+
+	long long SumRange(size_t begin, size_t end, bool resync, uint64_t& bytesRead) const {
+		size_t pos = begin;
+		if (resync) {	//we might be in the middle of a number or delimiter, find our way to the end of a delimiter
+			size_t length = 0;
+			while (pos < size && (length = DelimAt(pos)) == 0) ++pos;
+			if (pos >= end) {	//no delimiter starts in this chunk, a later chunk owns these numbers
+				bytesRead += std::max(pos, end) - begin;
+				return 0;
+			}
+			pos += length;	//a delimiter that can overlap itself (like ".." in "...") may be picked up half way, the estimate is off by one number
+		}
+
+		long long sum = 0;
+		while (pos < size) {
+			size_t length = DelimAt(pos);
+			if (length) {
+				if (pos >= end) break;	//first delimiter of the next chunk, it owns what comes after
+				pos += length;
+				continue;
+			}
+			size_t start = pos;
+			while (pos < size && DelimAt(pos) == 0) ++pos;
+			int value = ParseTokenValue(data + start, data + pos);
+			if (value < 0) throw NegativeNumberException(value);
+			if (value <= 1000) sum += value;
+		}
+		bytesRead += std::max(pos, end) - begin;
+		return sum;
+	}
+
+	const char* data;
+	size_t size;
+	size_t chunkSize;
+	DelimSpec spec;
+};
+
+SampledSum EstimateSum(const char* data, size_t size, const SampleOptions& options = SampleOptions()) {
+	ChunkSampler sampler(data, size, std::max<size_t>(options.chunkSize, 1));
+	SampledSum result;
+	result.chunksTotal = sampler.ChunkCount();
+	uint64_t total = result.chunksTotal;
+
+	if (total == 0 || options.byteBudget >= size) {	//the budget covers the whole file, just add it up
+		result.estimate = double(sampler.SumAll(result.bytesRead));
+		result.low = result.high = result.estimate;
+		result.chunksSampled = total;
+		result.exact = true;
+		return result;
+	}
+
+	std::mt19937_64 random(options.seed);
+	std::uniform_int_distribution<uint64_t> pick(0, total - 1);
+	std::unordered_set<uint64_t> sampled;
+	double z = ZScore(options.confidence);
+	double mean = 0, squares = 0;	//running mean and sum of squared differences of the chunk sums (Welford)
+
+	while (sampled.size() < total) {
+		uint64_t chunk = pick(random);
+		if (!sampled.insert(chunk).second) continue;	//without replacement
+		double x = double(sampler.Sum(chunk, result.bytesRead));
+		double n = double(sampled.size());
+		double delta = x - mean;
+		mean += delta / n;
+		squares += delta * (x - mean);
+
+		result.estimate = mean * double(total);
+		double halfWidth = 0;
+		if (n > 1) halfWidth = z * double(total) * std::sqrt(squares / (n - 1) / n * (1 - n / double(total)));	//with finite population correction
+		result.low = result.estimate - halfWidth;
+		result.high = result.estimate + halfWidth;
+
+		if (result.bytesRead >= options.byteBudget) break;
+		if (options.targetError > 0 && n >= 30 && halfWidth <= options.targetError * std::fabs(result.estimate)) break;	//30 chunks before trusting the spread
+	}
+	result.chunksSampled = sampled.size();
+	result.exact = result.chunksSampled == total;
+	if (result.low < 0) result.low = 0;
+	return result;
+}
+
+SampledSum EstimateSum(const std::string& path, const SampleOptions& options = SampleOptions()) {
+	MappedFile file(path);
+	return EstimateSum(file.Data(), file.Size(), options);
+}
+
+int main()
+{
+	try{
+
+		std::cout << "Accepts the following syntax:\n**\nstring-of-numbers\n**\n[delimiter]\n[more delimiters...]\nstring-of-numbers\n**\n";
+		std::string numbers = "[,,][..]";
+		for (int i = 0; i < 100000; ++i) numbers += std::to_string(i % 1000) + (i % 2 ? ",," : "..");
+		std::ofstream("numbers.txt", std::ios::binary) << numbers;
+
+		SampleOptions options;
+		options.chunkSize = 4096;
+		SampledSum exact = EstimateSum("numbers.txt", options);
+		std::cout << (long long)exact.estimate << ' ' << Add(numbers) << ' ' << exact.exact << '\n';
+
+		options.byteBudget = numbers.size() / 10;
+		SampledSum sampled = EstimateSum("numbers.txt", options);
+		std::cout << (sampled.low <= exact.estimate && exact.estimate <= sampled.high) << ' ' << sampled.chunksSampled << '/' << sampled.chunksTotal << '\n';
+
+		std::ofstream("numbers.txt", std::ios::binary) << "[\n]3\n9\n-1";
+		EstimateSum("numbers.txt");
+
+		//Expected output:
+		//49950000 49950000 1. the budget covers the whole file so every chunk is read
+		//1 12/120. about a tenth of the chunks are read and the real sum is inside the interval
+		//Exception. Negative number
+	}
+	catch (std::exception& e) {
+		std::cerr << "Exception: " << e.what() << '\n';
+	}
+	std::remove("numbers.txt");
+	system("pause");	//prevent cmd window from closing on windows
+    return 0;
+}
\ No newline at end of file
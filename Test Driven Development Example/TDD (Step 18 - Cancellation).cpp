@@ -0,0 +1,328 @@
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//18.
+//Let a long running Add be cancelled or given a deadline, and report how far it has got along the way.
+//The checks happen once per chunk so the inner loop doesn't slow down, and a stopped Add gives back a partial result with a status
+// - Added StreamState, StreamFeed() and StreamFinish() from Step 16
+//	 Added CancellationToken, AddControl and AddControlled(). Every chunk is fed to the stream scan, then the token and the deadline
+//	 are checked and onProgress is told how many bytes are done and the sum so far
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+struct StreamState {	//everything a streamed scan needs to carry on with the next piece
+	int stage = 0;	//0 nothing read yet, 1 reading delimiters, 2 reading numbers
+	bool usingDelim = false;
+	std::vector<std::string> delimiters;
+	size_t maxDelim = 1;
+	std::string pending;	//bytes we can't decide on until more arrive
+	std::string substring;	//the number being read
+	unsigned long long offset = 0;	//stream offset of pending.front()
+	unsigned long long tokenStart = 0;	//stream offset of substring.front()
+};
+
+//Reads the next piece of the stream, calling onToken(substring, offset) for every number that is known to have ended.
+//final means nothing else is coming, so nothing is held back
+template <typename F>
+void StreamFeed(StreamState& state, const char* data, size_t size, F onToken, bool final = false) {
+	std::string& pending = state.pending;
+	pending.append(data, size);
+	size_t i = 0;
+
+	if (state.stage == 0 && pending.size()) {	//the first character decides if there are delimiters, like the top of Add()
+		state.usingDelim = !isdigit(pending.front());
+		state.stage = state.usingDelim ? 1 : 2;
+		if (state.usingDelim) state.delimiters.assign(1, "");
+	}
+
+	while (state.stage == 1 && i < pending.size()) {
+		if (pending[i] == '[') {
+			++i;
+			continue;
+		}
+		if (pending[i] == ']') {
+			if ((i + 1) >= pending.size() && !final) break;	//need the next character to know if another delim follows
+			if ((i + 1) < pending.size() && pending[i + 1] != '[') {
+				state.stage = 2;
+				for (const std::string& delim : state.delimiters) state.maxDelim = std::max(state.maxDelim, delim.size());
+			}
+			else state.delimiters.push_back("");
+			++i;
+			continue;
+		}
+		state.delimiters[state.delimiters.size() - 1] += pending[i++];
+	}
+
+	while (state.stage == 2 && i < pending.size()) {
+		size_t delimLength = 0;
+		if (!state.usingDelim) delimLength = isdigit(pending[i]) ? 0 : 1;
+		else {
+			if (pending.size() - i < state.maxDelim && !final) break;	//a delim might start here and end in the next piece
+			for (const std::string& delim : state.delimiters) {
+				if (delim.size() && pending[i] == delim.front() && pending.compare(i, delim.size(), delim) == 0) {
+					delimLength = delim.size();
+					break;
+				}
+			}
+		}
+
+		if (delimLength) {
+			if (state.substring != "") {
+				onToken(state.substring, state.tokenStart);
+				state.substring = "";
+			}
+			i += delimLength;
+		}
+		else {
+			if (state.substring == "") state.tokenStart = state.offset + i;
+			state.substring += pending[i++];
+		}
+	}
+
+	pending.erase(0, i);
+	state.offset += i;
+}
+
+template <typename F>
+void StreamFinish(StreamState& state, F onToken) {	//end of the stream, hands out whatever was held back
+	StreamFeed(state, nullptr, 0, onToken, true);
+	if (state.substring != "") {
+		onToken(state.substring, state.tokenStart);
+		state.substring = "";
+	}
+}
+
+class CancellationToken {	//shared between the caller and a running AddControlled()
+public:
+	void Cancel() { cancelled.store(true, std::memory_order_relaxed); }
+	bool IsCancelled() const { return cancelled.load(std::memory_order_relaxed); }
+
+private:
+	std::atomic<bool> cancelled{ false };
+};
+
+enum AddStatus {
+	AddCompleted,
+	AddCancelled,
+	AddDeadlineExceeded
+};
+
+struct AddProgress {
+	unsigned long long bytesDone;
+	long long partialSum;	//numbers that have ended in the bytes done so far
+};
+
+struct AddOutcome {
+	AddStatus status;
+	long long sum;	//the same as Add() when completed, otherwise the sum of the numbers read before stopping
+	unsigned long long bytesDone;
+};
+
+struct AddControl {
+	const CancellationToken* cancel = nullptr;
+	std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+	std::function<void(const AddProgress&)> onProgress;
+	size_t chunkSize = 1 << 20;	//how many bytes are read between checks
+};
+
+//Add() that can be stopped. Negatives still throw NegativeNumberException
+AddOutcome AddControlled(const char* data, size_t size, const AddControl& control) {
+	StreamState state;
+	long long sum = 0;
+	auto onToken = [&sum](const std::string& substring, unsigned long long) { sum += StringToNumber<int>(substring); };
+	size_t chunkSize = std::max<size_t>(control.chunkSize, 1);
+
+	size_t done = 0;
+	while (done < size) {
+		if (control.cancel && control.cancel->IsCancelled()) return AddOutcome{ AddCancelled, sum, done };
+		if (std::chrono::steady_clock::now() >= control.deadline) return AddOutcome{ AddDeadlineExceeded, sum, done };
+
+		size_t length = std::min(chunkSize, size - done);
+		StreamFeed(state, data + done, length, onToken);
+		done += length;
+		if (control.onProgress) control.onProgress(AddProgress{ done, sum });
+	}
+	StreamFinish(state, onToken);
+	return AddOutcome{ AddCompleted, sum, done };
+}
+
+AddOutcome AddControlled(const std::string& numbers, const AddControl& control) {
+	return AddControlled(numbers.data(), numbers.size(), control);
+}
+
+int main()
+{
+	try{
+
+		std::cout << "Accepts the following syntax:\n**\nstring-of-numbers\n**\n[delimiter]\n[more delimiters...]\nstring-of-numbers\n**\n";
+		AddControl control;
+		control.chunkSize = 4;
+		control.onProgress = [](const AddProgress& progress) { std::cout << progress.bytesDone << ':' << progress.partialSum << ' '; };
+		AddOutcome outcome = AddControlled("[,,][..]1..2,,3", control);
+		std::cout << '\n' << outcome.status << ' ' << outcome.sum << '\n';
+
+		CancellationToken token;
+		control.cancel = &token;
+		control.onProgress = [&token](const AddProgress& progress) { if (progress.partialSum >= 3) token.Cancel(); };
+		outcome = AddControlled("[;]1;2;3;4;5;6", control);
+		std::cout << outcome.status << ' ' << outcome.sum << ' ' << outcome.bytesDone << '\n';
+
+		control.cancel = nullptr;
+		control.deadline = std::chrono::steady_clock::now();
+		outcome = AddControlled("1 2 3", control);
+		std::cout << outcome.status << ' ' << outcome.sum << ' ' << outcome.bytesDone << '\n';
+
+		control.deadline = std::chrono::steady_clock::time_point::max();
+		AddControlled("[\n]3\n9\n-1", control);
+
+		//Expected output:
+		//4:0 8:0 12:1 15:3 . progress after every 4 bytes, 3 hadn't ended until the end of the string
+		//0 6. completed, 1 + 2 + 3
+		//1 3 8. cancelled once 1 and 2 were read
+		//2 0 0. the deadline had already passed
+		//Exception. Negative number
+	}
+	catch (std::exception& e) {
+		std::cerr << "Exception: " << e.what() << '\n';
+	}
+	system("pause");	//prevent cmd window from closing on windows
+    return 0;
+}
\ No newline at end of file
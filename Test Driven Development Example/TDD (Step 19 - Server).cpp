@@ -0,0 +1,465 @@
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#ifdef __linux__
+#include <cerrno>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//19.
+//Serve Add over a unix domain socket or localhost TCP so callers don't need a process per request. Use an epoll loop per core
+//and a simple framed protocol, allow many requests in flight on one connection and answer them in the order they were sent
+// - Added AddBatch(), which runs Add() over a list of strings and gives back the sum or the negative for each one
+//	 Added EncodeFrame() and ProcessFrames(). A request is a 4 byte little endian length and the string, a response is a status byte
+//	 (0 for a sum, 1 for a negative) and a 4 byte little endian value. Every complete request in a read is run as one batch
+//	 Added RunServer() (linux only), one epoll loop per thread all sharing the listening socket, and SendRequests() for clients
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :number(number), msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+
+	int number;	//the negative that was passed
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+struct BatchResult {
+	bool ok;	//false if a negative was found
+	int value;	//the sum, or the negative if ok is false
+};
+
+void AddBatch(const std::string* inputs, size_t count, BatchResult* results) {	//never throws for negatives, they go in the results
+	for (size_t i = 0; i < count; ++i) {
+		try {
+			results[i] = BatchResult{ true, Add(inputs[i]) };
+		}
+		catch (NegativeNumberException& e) {
+			results[i] = BatchResult{ false, e.number };
+		}
+	}
+}
+
+void PutUint32(std::string& out, uint32_t value) {	//little endian whatever the machine is
+	for (int i = 0; i < 4; ++i) out += char((value >> (8 * i)) & 0xFF);
+}
+
+uint32_t GetUint32(const char* in) {
+	uint32_t value = 0;
+	for (int i = 0; i < 4; ++i) value |= uint32_t(uint8_t(in[i])) << (8 * i);
+	return value;
+}
+
+void EncodeFrame(std::string& out, const std::string& numbers) {	//a request
+	PutUint32(out, uint32_t(numbers.size()));
+	out += numbers;
+}
+
+const size_t ResponseSize = 5;
+
+//Runs every complete request in data as one batch and appends the responses in the same order. Returns how many bytes were used,
+//anything after that is a request that hasn't fully arrived yet. A request longer than maxFrame throws std::length_error
+size_t ProcessFrames(const char* data, size_t size, std::string& responses, size_t maxFrame = 1 << 20) {
+	std::vector<std::string> batch;
+	size_t used = 0;
+	while (size - used >= 4) {
+		size_t length = GetUint32(data + used);
+		if (length > maxFrame) throw std::length_error("request is " + std::to_string(length) + " bytes");
+		if (size - used - 4 < length) break;
+		batch.emplace_back(data + used + 4, length);
+		used += 4 + length;
+	}
+
+	std::vector<BatchResult> results(batch.size());
+	AddBatch(batch.data(), batch.size(), results.data());
+	for (const BatchResult& result : results) {
+		responses += char(result.ok ? 0 : 1);
+		PutUint32(responses, uint32_t(result.value));
+	}
+	return used;
+}
+
+BatchResult DecodeResponse(const char* response) {
+	return BatchResult{ response[0] == 0, int(GetUint32(response + 1)) };
+}
+
+struct ServerOptions {
+	std::string unixPath;	//listen on this unix domain socket if it is set
+	uint16_t tcpPort = 0;	//otherwise on 127.0.0.1 at this port, 0 lets the system pick one
+	std::function<void(uint16_t port)> onListening;	//called once connections can be made, with the port that was bound (0 for a unix socket)
+	unsigned threads = 0;	//event loops, 0 for one per core
+	size_t maxFrame = 1 << 20;
+};
+
+#ifdef __linux__
+class EventLoop {	//one thread's epoll loop and the connections it accepted
+public:
+	EventLoop(int listener, size_t maxFrame) :listener(listener), maxFrame(maxFrame), poll(epoll_create1(0)) {
+		epoll_event event = epoll_event();
+		event.events = EPOLLIN | EPOLLEXCLUSIVE;	//only one of the loops is woken for each new connection
+		event.data.fd = listener;
+		epoll_ctl(poll, EPOLL_CTL_ADD, listener, &event);
+	}
+
+	~EventLoop() {
+		for (auto& connection : connections) close(connection.first);
+		close(poll);
+	}
+
+	void Run(const std::atomic<bool>& stop) {
+		epoll_event events[64];
+		while (!stop.load()) {
+			int ready = epoll_wait(poll, events, 64, 100);	//wake up now and then to look at stop
+			for (int i = 0; i < ready; ++i) {
+				if (events[i].data.fd == listener) Accept();
+				else Serve(events[i].data.fd, events[i].events);
+			}
+		}
+	}
+
+private:
+	struct Connection {
+		std::string in;	//bytes of requests that haven't fully arrived
+		std::string out;	//responses the socket wasn't ready for
+		bool reading = true;	//false once the client has shut down its side, it still gets every answer
+		uint32_t events = EPOLLIN;	//what the connection is registered for
+	};
+
+	void Accept() {
+		int fd;
+		while ((fd = accept4(listener, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0) {
+			int on = 1;
+			setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));	//fails harmlessly on unix sockets
+			epoll_event event = epoll_event();
+			event.events = EPOLLIN;
+			event.data.fd = fd;
+			epoll_ctl(poll, EPOLL_CTL_ADD, fd, &event);
+			connections[fd];
+		}
+	}
+
+	void Serve(int fd, uint32_t events) {
+		Connection& connection = connections[fd];
+		bool open = !(events & EPOLLERR);
+		if (connection.reading && (events & (EPOLLIN | EPOLLHUP))) {
+			char buffer[64 << 10];
+			ssize_t got;
+			while ((got = read(fd, buffer, sizeof(buffer))) > 0) connection.in.append(buffer, size_t(got));
+			if (got == 0) connection.reading = false;	//no more requests, but the ones already read are still answered
+			else if (errno != EAGAIN && errno != EWOULDBLOCK) open = false;
+
+			try {
+				size_t used = ProcessFrames(connection.in.data(), connection.in.size(), connection.out, maxFrame);
+				connection.in.erase(0, used);
+			}
+			catch (std::length_error&) {
+				open = false;
+			}
+		}
+		if (open) open = Flush(fd, connection);
+		if (open && !connection.reading && connection.out.empty()) open = false;	//everything it asked for has been sent
+		if (!open) {
+			close(fd);	//also takes it out of the epoll set
+			connections.erase(fd);
+		}
+	}
+
+	bool Flush(int fd, Connection& connection) {	//writes what it can, false if the connection is broken
+		size_t sent = 0;
+		while (sent < connection.out.size()) {
+			ssize_t wrote = send(fd, connection.out.data() + sent, connection.out.size() - sent, MSG_NOSIGNAL);
+			if (wrote < 0) {
+				if (errno != EAGAIN && errno != EWOULDBLOCK) return false;
+				break;
+			}
+			sent += size_t(wrote);
+		}
+		connection.out.erase(0, sent);
+
+		//only ask for EPOLLOUT while there is something left to send, and stop asking for EPOLLIN after the client shut down its side
+		uint32_t wanted = (connection.reading ? uint32_t(EPOLLIN) : 0u) | (connection.out.empty() ? 0u : uint32_t(EPOLLOUT));
+		if (wanted != connection.events) {
+			epoll_event event = epoll_event();
+			event.events = wanted;
+			event.data.fd = fd;
+			epoll_ctl(poll, EPOLL_CTL_MOD, fd, &event);
+			connection.events = wanted;
+		}
+		return true;
+	}
+
+	int listener;
+	size_t maxFrame;
+	int poll;
+	std::unordered_map<int, Connection> connections;
+};
+
+int Listen(const ServerOptions& options) {
+	int fd;
+	if (options.unixPath.size()) {
+		sockaddr_un address = sockaddr_un();
+		address.sun_family = AF_UNIX;
+		if (options.unixPath.size() >= sizeof(address.sun_path)) throw std::invalid_argument("unix socket path is too long");
+		std::copy(options.unixPath.begin(), options.unixPath.end(), address.sun_path);
+		unlink(options.unixPath.c_str());
+		fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+		if (fd < 0 || bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) throw std::runtime_error("can't bind " + options.unixPath);
+	}
+	else {
+		sockaddr_in address = sockaddr_in();
+		address.sin_family = AF_INET;
+		address.sin_port = htons(options.tcpPort);
+		address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+		int on = 1;
+		setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+		if (fd < 0 || bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) throw std::runtime_error("can't bind port " + std::to_string(options.tcpPort));
+	}
+	if (listen(fd, SOMAXCONN) < 0) throw std::runtime_error("can't listen");
+	return fd;
+}
+
+uint16_t BoundPort(int listener) {	//the TCP port listener has, 0 if it isn't a TCP socket
+	sockaddr_in address = sockaddr_in();
+	socklen_t size = sizeof(address);
+	if (getsockname(listener, reinterpret_cast<sockaddr*>(&address), &size) < 0 || address.sin_family != AF_INET) return 0;
+	return ntohs(address.sin_port);
+}
+
+//Serves until stop is set. Blocks the calling thread, which runs one of the event loops
+void RunServer(const ServerOptions& options, const std::atomic<bool>& stop) {
+	int listener = Listen(options);
+	unsigned threads = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+	std::vector<std::unique_ptr<EventLoop>> loops;
+	for (unsigned i = 0; i < threads; ++i) loops.emplace_back(new EventLoop(listener, options.maxFrame));
+	if (options.onListening) options.onListening(BoundPort(listener));
+
+	std::vector<std::thread> workers;
+	for (unsigned i = 1; i < threads; ++i) workers.emplace_back([&, i]() { loops[i]->Run(stop); });
+	loops[0]->Run(stop);
+	for (std::thread& worker : workers) worker.join();
+	loops.clear();
+	close(listener);
+	if (options.unixPath.size()) unlink(options.unixPath.c_str());
+}
+
+//Client side, sends every request before reading any response
+std::vector<BatchResult> SendRequests(const std::string& unixPath, const std::vector<std::string>& inputs) {
+	sockaddr_un address = sockaddr_un();
+	address.sun_family = AF_UNIX;
+	std::copy(unixPath.begin(), unixPath.end(), address.sun_path);
+	int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (fd < 0 || connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+		if (fd >= 0) close(fd);
+		throw std::runtime_error("can't connect to " + unixPath);
+	}
+
+	std::string requests;
+	for (const std::string& numbers : inputs) EncodeFrame(requests, numbers);
+	std::thread writer([&]() {	//write on another thread so a full socket buffer can't deadlock with the reads
+		for (size_t sent = 0; sent < requests.size();) {
+			ssize_t wrote = send(fd, requests.data() + sent, requests.size() - sent, MSG_NOSIGNAL);
+			if (wrote <= 0) break;
+			sent += size_t(wrote);
+		}
+	});
+
+	std::string responses;
+	char buffer[64 << 10];
+	ssize_t got;
+	while (responses.size() < inputs.size() * ResponseSize && (got = read(fd, buffer, sizeof(buffer))) > 0) responses.append(buffer, size_t(got));
+	writer.join();
+	close(fd);
+
+	std::vector<BatchResult> results;
+	for (size_t i = 0; i + ResponseSize <= responses.size(); i += ResponseSize) results.push_back(DecodeResponse(responses.data() + i));
+	return results;
+}
+#else
+void RunServer(const ServerOptions&, const std::atomic<bool>&) {
+	throw std::runtime_error("server mode needs epoll, it is only available on linux");
+}
+#endif
+
+int main()
+{
+	try{
+
+		std::cout << "Accepts the following syntax:\n**\nstring-of-numbers\n**\n[delimiter]\n[more delimiters...]\nstring-of-numbers\n**\n";
+		std::string requests;
+		EncodeFrame(requests, "1 2 3");
+		EncodeFrame(requests, "[;]23;/4;;7");
+		EncodeFrame(requests, "[\n]3\n9\n-1");
+		std::string responses;
+		size_t used = ProcessFrames(requests.data(), requests.size() - 2, responses);
+		std::cout << used << ' ' << responses.size() / ResponseSize << '\n';
+		used += ProcessFrames(requests.data() + used, requests.size() - used, responses);
+		for (size_t i = 0; i < responses.size(); i += ResponseSize) std::cout << DecodeResponse(responses.data() + i).ok << ':' << DecodeResponse(responses.data() + i).value << ' ';
+		std::cout << '\n';
+
+#ifdef __linux__
+		ServerOptions options;
+		options.unixPath = "stringcalc.sock";
+		options.threads = 2;
+		std::atomic<bool> stop(false);
+		std::thread server([&]() { RunServer(options, stop); });
+		std::this_thread::sleep_for(std::chrono::milliseconds(200));
+		for (const BatchResult& result : SendRequests(options.unixPath, { "[,,][..]1..2,,3", "[;]", "[-]1-2" })) std::cout << result.ok << ':' << result.value << ' ';
+		std::cout << '\n';
+		stop = true;
+		server.join();
+#endif
+
+		//Expected output:
+		//24 2. the last request hasn't fully arrived so only the first two are answered
+		//1:6 1:30 0:-1. then the third, which has a negative so it is sent with status 1
+		//1:6 1:0 1:3. answered by the server, in the order they were sent
+	}
+	catch (std::exception& e) {
+		std::cerr << "Exception: " << e.what() << '\n';
+	}
+	system("pause");	//prevent cmd window from closing on windows
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,549 @@
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//20.
+//Give producers on the same machine a shared memory way in, so nothing gets copied through a socket. Requests are written straight
+//into a shared ring, workers add them up where they are and put the answer back in the same place, and idle workers sleep on a futex
+// - Added SharedRing, a memfd mapping (plain memory on other platforms) holding a header and a ring of fixed size slots
+//	 Claim() hands out a slot to write a request into and Publish() passes it to the workers, Post() does both from a string
+//	 Wait() sleeps until a worker has answered the request and frees the slot. ServeRing() is a worker, it runs until Close()
+// - Added Evaluate(), which gets the same result as Add() from the Step 12 tokens without copying the input
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+struct DelimSpec {
+	bool usingDelim = false;	//false means any non digit splits numbers
+	std::vector<std::string> delimiters;
+	size_t bodyStart = 0;	//offset of the first character after the delimiter declarations
+};
+
+DelimSpec ParseDelimSpec(const char* numbers, size_t size) {	//reads the delimiters the same way as the top of Add()
+	DelimSpec spec;
+	if (size == 0 || isdigit(numbers[0])) return spec;
+
+	spec.usingDelim = true;
+	spec.delimiters.push_back("");
+	size_t i = 0;
+	for (; i < size; ++i) {
+		if (numbers[i] == '[') continue;
+		if (numbers[i] == ']') {
+			if ((i + 1) < size && numbers[i + 1] != '[') {
+				++i;
+				break;
+			}
+			spec.delimiters.push_back("");
+			continue;
+		}
+		spec.delimiters[spec.delimiters.size() - 1] += numbers[i];
+	}
+	spec.bodyStart = i;
+	return spec;
+}
+
+DelimSpec ParseDelimSpec(const std::string& numbers) {
+	return ParseDelimSpec(numbers.data(), numbers.size());
+}
+
+int ParseTokenValue(const char* first, const char* last) {	//same result as reading an int from a stringstream, without the copy
+	while (first != last && (*first == ' ' || (*first >= '\t' && *first <= '\r'))) ++first;	//stringstream skips leading whitespace
+	bool negative = false;
+	if (first != last && (*first == '-' || *first == '+')) negative = *first++ == '-';
+	long long value = 0;
+	for (; first != last && *first >= '0' && *first <= '9'; ++first) {
+		value = value * 10 + (*first - '0');
+		if (value > 1LL + INT_MAX) value = 1LL + INT_MAX;	//out of range, stringstream gives back INT_MAX or INT_MIN
+	}
+	if (negative) return value > INT_MAX ? INT_MIN : int(-value);
+	return value > INT_MAX ? INT_MAX : int(value);
+}
+
+struct Token {
+	int value;	//converted without the Step 5 and 6 rules, so negatives and numbers over 1000 come through as they are
+	size_t offset;
+	size_t length;
+};
+
+class TokenIterator {
+public:
+	using iterator_category = std::input_iterator_tag;
+	using iterator_concept = std::forward_iterator_tag;
+	using value_type = Token;
+	using difference_type = std::ptrdiff_t;
+	using pointer = void;
+	using reference = Token;
+
+	TokenIterator() = default;
+	TokenIterator(const char* data, size_t size, const DelimSpec* spec) :data(data), size(size), spec(spec), position(spec->bodyStart), atEnd(false) {
+		Next();
+	}
+
+	Token operator*() const { return current; }
+	TokenIterator& operator++() { Next(); return *this; }
+	TokenIterator operator++(int) { TokenIterator before = *this; Next(); return before; }
+
+	bool operator==(const TokenIterator& other) const {
+		return atEnd == other.atEnd && (atEnd || current.offset == other.current.offset);
+	}
+	bool operator!=(const TokenIterator& other) const { return !(*this == other); }
+
+private:
+	size_t DelimAt(size_t i) const {	//length of the delimiter found at i, 0 if i is part of a number
+		if (!spec->usingDelim) return (data[i] >= '0' && data[i] <= '9') ? 0 : 1;
+		for (const std::string& delim : spec->delimiters) {
+			if (delim.empty() || data[i] != delim.front() || size - i < delim.size()) continue;
+			if (std::memcmp(data + i, delim.data(), delim.size()) == 0) return delim.size();
+		}
+		return 0;
+	}
+
+	void Next() {
+		size_t length;
+		while (position < size && (length = DelimAt(position)) != 0) position += length;	//skip delimiters until a number starts
+		if (position >= size) {
+			atEnd = true;
+			return;
+		}
+		size_t start = position;
+		while (position < size && DelimAt(position) == 0) ++position;
+		current.offset = start;
+		current.length = position - start;
+		current.value = ParseTokenValue(data + start, data + position);
+	}
+
+	const char* data = nullptr;
+	size_t size = 0;
+	const DelimSpec* spec = nullptr;
+	size_t position = 0;
+	Token current = Token();
+	bool atEnd = true;	//a default constructed iterator is an end iterator
+};
+
+class TokenRange {
+public:
+	TokenRange() = default;
+	TokenRange(const char* data, size_t size, const DelimSpec& spec) :data(data), size(size), spec(&spec) {}
+
+	TokenIterator begin() const { return spec ? TokenIterator(data, size, spec) : TokenIterator(); }
+	TokenIterator end() const { return TokenIterator(); }
+
+private:
+	const char* data = nullptr;
+	size_t size = 0;
+	const DelimSpec* spec = nullptr;
+};
+
+//The range points into input and spec, both have to outlive it
+TokenRange tokens(const char* data, size_t size, const DelimSpec& spec) {
+	return TokenRange(data, size, spec);
+}
+
+TokenRange tokens(const std::string& input, const DelimSpec& spec) {
+	return TokenRange(input.data(), input.size(), spec);
+}
+
+struct BatchResult {
+	bool ok;	//false if a negative was found
+	int value;	//the sum, or the negative if ok is false
+};
+
+BatchResult Evaluate(const char* data, size_t size) {	//same result as Add(), reads the input where it is
+	DelimSpec spec = ParseDelimSpec(data, size);
+	int result = 0;
+	for (Token token : tokens(data, size, spec)) {
+		if (token.value < 0) return BatchResult{ false, token.value };
+		if (token.value <= 1000) result += token.value;
+	}
+	return BatchResult{ true, result };
+}
+
+void FutexWait(std::atomic<uint32_t>& word, uint32_t expected) {	//sleeps while word is still expected, may wake early
+#ifdef __linux__
+	timespec timeout = { 0, 100 * 1000 * 1000 };
+	syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT, expected, &timeout, nullptr, 0);	//not the private futex, other processes share the word
+#else
+	if (word.load() == expected) std::this_thread::yield();
+#endif
+}
+
+void FutexWake(std::atomic<uint32_t>& word) {
+#ifdef __linux__
+	syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#else
+	(void)word;
+#endif
+}
+
+const uint32_t RingMagic = 0x53524E47;
+const size_t SlotBytes = 4072;	//longest request, makes a slot 4096 bytes
+
+//A slot with ticket t goes through sequence t (free), t + 1 (request written), t + 2 (answered) and t + slot count (free for the next lap)
+struct alignas(64) RingSlot {
+	std::atomic<uint32_t> sequence;
+	std::atomic<uint32_t> waiting;	//someone is asleep on sequence
+	uint32_t length;
+	uint32_t ok;
+	int32_t value;
+	char data[SlotBytes];
+};
+
+struct RingHeader {
+	uint32_t magic;
+	uint32_t slots;	//a power of two
+	alignas(64) std::atomic<uint32_t> tail;	//next ticket for producers
+	alignas(64) std::atomic<uint32_t> head;	//next ticket for workers
+	alignas(64) std::atomic<uint32_t> posted;	//bumped for every request and on close, workers sleep on it
+	std::atomic<uint32_t> sleepers;
+	std::atomic<uint32_t> closed;
+};
+
+class SharedRing {
+public:
+	static SharedRing Create(uint32_t slots = 64) {	//slots is rounded up to a power of two
+		uint32_t count = 4;
+		while (count < slots) count *= 2;
+		SharedRing ring;
+		ring.size = sizeof(RingHeader) + count * sizeof(RingSlot);
+#ifdef __linux__
+		ring.fd = int(syscall(SYS_memfd_create, "stringcalc", 1u));	//MFD_CLOEXEC
+		if (ring.fd < 0 || ftruncate(ring.fd, off_t(ring.size)) < 0) throw std::runtime_error("can't create the shared memory");
+		ring.Map();
+#else
+		ring.memory = static_cast<char*>(::operator new(ring.size));
+#endif
+		RingHeader* header = new (ring.memory) RingHeader();
+		header->slots = count;
+		for (uint32_t i = 0; i < count; ++i) {
+			RingSlot* slot = new (ring.memory + sizeof(RingHeader) + i * sizeof(RingSlot)) RingSlot();
+			slot->sequence.store(i);
+		}
+		header->magic = RingMagic;
+		return ring;
+	}
+
+#ifdef __linux__
+	static SharedRing Attach(int fd) {	//a ring another process created and passed the descriptor of
+		struct stat info;
+		if (fstat(fd, &info) < 0 || size_t(info.st_size) < sizeof(RingHeader)) throw std::runtime_error("not a shared ring");
+		SharedRing ring;
+		ring.fd = dup(fd);
+		ring.size = size_t(info.st_size);
+		ring.Map();
+		if (ring.Header().magic != RingMagic || ring.size != sizeof(RingHeader) + ring.Header().slots * sizeof(RingSlot)) throw std::runtime_error("not a shared ring");
+		return ring;
+	}
+#endif
+
+	SharedRing(SharedRing&& other) :memory(other.memory), size(other.size), fd(other.fd) {
+		other.memory = nullptr;
+		other.fd = -1;
+	}
+	SharedRing(const SharedRing&) = delete;
+	SharedRing& operator=(const SharedRing&) = delete;
+
+	~SharedRing() {
+#ifdef __linux__
+		if (memory) munmap(memory, size);
+		if (fd >= 0) close(fd);
+#else
+		::operator delete(memory);
+#endif
+	}
+
+	int Fd() const { return fd; }	//-1 when it isn't shared memory
+
+	char* Claim(uint32_t& ticket) {	//room for SlotBytes of request, waits while the ring is full
+		RingHeader& header = Header();
+		uint32_t position = header.tail.load(std::memory_order_relaxed);
+		for (;;) {
+			RingSlot& slot = Slot(position);
+			uint32_t sequence = slot.sequence.load(std::memory_order_acquire);
+			int32_t lap = int32_t(sequence - position);
+			if (lap == 0) {
+				if (header.tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+					ticket = position;
+					return slot.data;
+				}
+			}
+			else if (lap < 0) {	//the request from the last lap hasn't been collected yet
+				Sleep(slot, sequence);
+				position = header.tail.load(std::memory_order_relaxed);
+			}
+			else position = header.tail.load(std::memory_order_relaxed);
+		}
+	}
+
+	void Publish(uint32_t ticket, size_t length) {
+		if (length > SlotBytes) throw std::length_error("request is longer than a slot");
+		RingHeader& header = Header();
+		RingSlot& slot = Slot(ticket);
+		slot.length = uint32_t(length);
+		slot.sequence.store(ticket + 1, std::memory_order_release);
+		header.posted.fetch_add(1);
+		if (header.sleepers.load()) FutexWake(header.posted);	//no system call while every worker is busy
+	}
+
+	uint32_t Post(const std::string& numbers) {
+		if (numbers.size() > SlotBytes) throw std::length_error("request is longer than a slot");
+		uint32_t ticket;
+		std::memcpy(Claim(ticket), numbers.data(), numbers.size());
+		Publish(ticket, numbers.size());
+		return ticket;
+	}
+
+	BatchResult Wait(uint32_t ticket) {	//the answer to a published request, the slot is reused after this
+		RingSlot& slot = Slot(ticket);
+		uint32_t sequence;
+		while ((sequence = slot.sequence.load(std::memory_order_acquire)) != ticket + 2) Sleep(slot, sequence);
+		BatchResult result = { slot.ok != 0, slot.value };
+		Release(slot, ticket + Header().slots);
+		return result;
+	}
+
+	bool Serve() {	//answers one request, false once the ring is closed and empty
+		RingHeader& header = Header();
+		for (;;) {
+			uint32_t posted = header.posted.load();
+			uint32_t position = header.head.load(std::memory_order_relaxed);
+			RingSlot& slot = Slot(position);
+			int32_t lap = int32_t(slot.sequence.load(std::memory_order_acquire) - (position + 1));
+			if (lap == 0) {
+				if (!header.head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) continue;
+				BatchResult result = Evaluate(slot.data, slot.length);
+				slot.ok = result.ok;
+				slot.value = result.value;
+				Release(slot, position + 2);
+				return true;
+			}
+			if (lap > 0) continue;	//another worker took it
+			if (header.closed.load()) return false;
+
+			header.sleepers.fetch_add(1);
+			position = header.head.load();
+			if (int32_t(Slot(position).sequence.load() - (position + 1)) < 0 && !header.closed.load()) FutexWait(header.posted, posted);
+			header.sleepers.fetch_sub(1);
+		}
+	}
+
+	void Close() {	//workers finish what is queued and stop
+		RingHeader& header = Header();
+		header.closed.store(1);
+		header.posted.fetch_add(1);
+		FutexWake(header.posted);
+	}
+
+private:
+	SharedRing() = default;
+
+#ifdef __linux__
+	void Map() {
+		void* mapped = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		if (mapped == MAP_FAILED) throw std::runtime_error("can't map the shared memory");
+		memory = static_cast<char*>(mapped);
+	}
+#endif
+
+	RingHeader& Header() const { return *reinterpret_cast<RingHeader*>(memory); }
+	RingSlot& Slot(uint32_t ticket) const {
+		return *reinterpret_cast<RingSlot*>(memory + sizeof(RingHeader) + (ticket & (Header().slots - 1)) * sizeof(RingSlot));
+	}
+
+	void Sleep(RingSlot& slot, uint32_t sequence) {
+		slot.waiting.store(1);
+		if (slot.sequence.load() == sequence) FutexWait(slot.sequence, sequence);
+	}
+
+	void Release(RingSlot& slot, uint32_t sequence) {
+		slot.sequence.store(sequence);	//ordered before the load of waiting, or a sleeper could be missed
+		if (slot.waiting.exchange(0)) FutexWake(slot.sequence);
+	}
+
+	char* memory = nullptr;
+	size_t size = 0;
+	int fd = -1;
+};
+
+void ServeRing(SharedRing& ring) {	//a worker, returns after Close()
+	while (ring.Serve());
+}
+
+int main()
+{
+	try{
+
+		std::cout << "Accepts the following syntax:\n**\nstring-of-numbers\n**\n[delimiter]\n[more delimiters...]\nstring-of-numbers\n**\n";
+		SharedRing ring = SharedRing::Create(8);
+		std::thread worker([&]() { ServeRing(ring); });
+
+		uint32_t first = ring.Post("1 2 3");
+		uint32_t second;
+		char* request = ring.Claim(second);	//written straight into shared memory
+		size_t length = std::sprintf(request, "[;]%d;%d;/4", 23, 7);
+		ring.Publish(second, length);
+		uint32_t third = ring.Post("[\n]3\n9\n-1");
+
+		BatchResult results[] = { ring.Wait(first), ring.Wait(second), ring.Wait(third) };
+		for (const BatchResult& result : results) std::cout << result.ok << ':' << result.value << ' ';
+		std::cout << '\n';
+		ring.Close();
+		worker.join();
+
+		//Expected output:
+		//1:6 1:30 0:-1
+	}
+	catch (std::exception& e) {
+		std::cerr << "Exception: " << e.what() << '\n';
+	}
+	system("pause");	//prevent cmd window from closing on windows
+    return 0;
+}
\ No newline at end of file
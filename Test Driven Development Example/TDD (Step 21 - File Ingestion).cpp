@@ -0,0 +1,590 @@
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#ifdef __linux__
+#include <cerrno>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//21.
+//Sum many files from disk without the workers waiting on read() between scans. Keep several reads in flight for each file and
+//across files with io_uring and registered buffers, and feed each buffer to the streaming scan once it is the next one for its file
+// - Added SumFiles(), which gives back a FileSum for every path, each file being one Add() input. It uses io_uring where the kernel
+//	 has it and plain reads otherwise, IngestOptions picks the buffer size and how many reads are in flight
+// - Reads finish in any order, a finished buffer waits until the bytes before it in the same file have been fed
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :number(number), msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+
+	int number;	//the negative that was passed
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+struct StreamState {	//everything a streamed scan needs to carry on with the next piece
+	int stage = 0;	//0 nothing read yet, 1 reading delimiters, 2 reading numbers
+	bool usingDelim = false;
+	std::vector<std::string> delimiters;
+	size_t maxDelim = 1;
+	std::string pending;	//bytes we can't decide on until more arrive
+	std::string substring;	//the number being read
+	unsigned long long offset = 0;	//stream offset of pending.front()
+	unsigned long long tokenStart = 0;	//stream offset of substring.front()
+};
+
+//Reads the next piece of the stream, calling onToken(substring, offset) for every number that is known to have ended.
+//final means nothing else is coming, so nothing is held back
+template <typename F>
+void StreamFeed(StreamState& state, const char* data, size_t size, F onToken, bool final = false) {
+	std::string& pending = state.pending;
+	pending.append(data, size);
+	size_t i = 0;
+
+	if (state.stage == 0 && pending.size()) {	//the first character decides if there are delimiters, like the top of Add()
+		state.usingDelim = !isdigit(pending.front());
+		state.stage = state.usingDelim ? 1 : 2;
+		if (state.usingDelim) state.delimiters.assign(1, "");
+	}
+
+	while (state.stage == 1 && i < pending.size()) {
+		if (pending[i] == '[') {
+			++i;
+			continue;
+		}
+		if (pending[i] == ']') {
+			if ((i + 1) >= pending.size() && !final) break;	//need the next character to know if another delim follows
+			if ((i + 1) < pending.size() && pending[i + 1] != '[') {
+				state.stage = 2;
+				for (const std::string& delim : state.delimiters) state.maxDelim = std::max(state.maxDelim, delim.size());
+			}
+			else state.delimiters.push_back("");
+			++i;
+			continue;
+		}
+		state.delimiters[state.delimiters.size() - 1] += pending[i++];
+	}
+
+	while (state.stage == 2 && i < pending.size()) {
+		size_t delimLength = 0;
+		if (!state.usingDelim) delimLength = isdigit(pending[i]) ? 0 : 1;
+		else {
+			if (pending.size() - i < state.maxDelim && !final) break;	//a delim might start here and end in the next piece
+			for (const std::string& delim : state.delimiters) {
+				if (delim.size() && pending[i] == delim.front() && pending.compare(i, delim.size(), delim) == 0) {
+					delimLength = delim.size();
+					break;
+				}
+			}
+		}
+
+		if (delimLength) {
+			if (state.substring != "") {
+				onToken(state.substring, state.tokenStart);
+				state.substring = "";
+			}
+			i += delimLength;
+		}
+		else {
+			if (state.substring == "") state.tokenStart = state.offset + i;
+			state.substring += pending[i++];
+		}
+	}
+
+	pending.erase(0, i);
+	state.offset += i;
+}
+
+template <typename F>
+void StreamFinish(StreamState& state, F onToken) {	//end of the stream, hands out whatever was held back
+	StreamFeed(state, nullptr, 0, onToken, true);
+	if (state.substring != "") {
+		onToken(state.substring, state.tokenStart);
+		state.substring = "";
+	}
+}
+
+struct FileSum {
+	long long sum = 0;
+	bool ok = true;	//false if a negative was found, sum is what was added before it
+	int negative = 0;
+	unsigned long long bytes = 0;	//bytes fed to the scan
+};
+
+struct IngestOptions {
+	size_t bufferSize = 256 << 10;
+	unsigned depth = 16;	//reads in flight at once, across all the files
+	bool allowUring = true;	//false always uses read()
+};
+
+enum IngestBackend { IngestUring, IngestRead };
+
+struct FileJob {	//one file being summed
+	StreamState state;
+	FileSum result;
+	int fd = -1;
+	unsigned long long size = 0;
+	unsigned long long nextRead = 0;	//offset of the next read to start
+	unsigned long long nextFeed = 0;	//offset of the next bytes the scan needs
+	bool finished = false;
+
+	void Feed(const char* data, size_t length) {
+		result.bytes += length;
+		if (!result.ok) return;
+		try {
+			StreamFeed(state, data, length, [this](const std::string& substring, unsigned long long) { result.sum += StringToNumber<int>(substring); });
+		}
+		catch (NegativeNumberException& e) {
+			result.ok = false;
+			result.negative = e.number;
+			size = nextRead;	//don't start any more reads for this file
+		}
+	}
+
+	void Finish() {
+		if (result.ok) {
+			try {
+				StreamFinish(state, [this](const std::string& substring, unsigned long long) { result.sum += StringToNumber<int>(substring); });
+			}
+			catch (NegativeNumberException& e) {
+				result.ok = false;
+				result.negative = e.number;
+			}
+		}
+		finished = true;
+	}
+};
+
+#ifdef __linux__
+int OpenJob(const std::string& path, FileJob& job) {
+	job.fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	struct stat info;
+	if (job.fd < 0 || fstat(job.fd, &info) < 0) throw std::runtime_error("can't open " + path);
+	job.size = (unsigned long long)info.st_size;
+	return job.fd;
+}
+
+void CloseJob(FileJob& job) {
+	if (job.fd >= 0) close(job.fd);
+	job.fd = -1;
+}
+
+class Uring {	//the submission and completion rings, set up with the raw system calls
+public:
+	Uring(unsigned entries, char* buffers, size_t bufferSize, unsigned bufferCount) {
+		io_uring_params params = io_uring_params();
+		fd = int(syscall(__NR_io_uring_setup, entries, &params));
+		if (fd < 0) throw std::runtime_error("io_uring isn't available");
+
+		sqSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+		cqSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+		bool single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+		if (single) sqSize = cqSize = std::max(sqSize, cqSize);
+		sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+		sq = Map(sqSize, IORING_OFF_SQ_RING);
+		cq = single ? sq : Map(cqSize, IORING_OFF_CQ_RING);
+		sqes = static_cast<io_uring_sqe*>(Map(sqesSize, IORING_OFF_SQES));
+		if (!sq || !cq || !sqes) {
+			Release();
+			throw std::runtime_error("can't map the io_uring rings");
+		}
+
+		char* s = static_cast<char*>(sq);
+		sqTail = reinterpret_cast<unsigned*>(s + params.sq_off.tail);
+		sqMask = *reinterpret_cast<unsigned*>(s + params.sq_off.ring_mask);
+		sqArray = reinterpret_cast<unsigned*>(s + params.sq_off.array);
+		char* c = static_cast<char*>(cq);
+		cqHead = reinterpret_cast<unsigned*>(c + params.cq_off.head);
+		cqTail = reinterpret_cast<unsigned*>(c + params.cq_off.tail);
+		cqMask = *reinterpret_cast<unsigned*>(c + params.cq_off.ring_mask);
+		cqes = reinterpret_cast<io_uring_cqe*>(c + params.cq_off.cqes);
+
+		std::vector<iovec> iovecs(bufferCount);	//registered once so the kernel doesn't map the pages on every read
+		for (unsigned i = 0; i < bufferCount; ++i) iovecs[i] = iovec{ buffers + i * bufferSize, bufferSize };
+		registered = syscall(__NR_io_uring_register, fd, IORING_REGISTER_BUFFERS, iovecs.data(), bufferCount) == 0;
+	}
+
+	~Uring() { Release(); }
+	Uring(const Uring&) = delete;
+	Uring& operator=(const Uring&) = delete;
+
+	void Read(int file, unsigned buffer, char* into, unsigned length, unsigned long long offset) {	//queued until Submit()
+		unsigned tail = *sqTail;
+		unsigned index = tail & sqMask;
+		io_uring_sqe& sqe = sqes[index];
+		sqe = io_uring_sqe();
+		sqe.opcode = registered ? IORING_OP_READ_FIXED : IORING_OP_READ;	//plain reads if the buffers couldn't be locked in memory
+		sqe.fd = file;
+		sqe.addr = (unsigned long long)(uintptr_t)into;
+		sqe.len = length;
+		sqe.off = offset;
+		sqe.buf_index = (unsigned short)buffer;
+		sqe.user_data = buffer;
+		sqArray[index] = index;
+		__atomic_store_n(sqTail, tail + 1, __ATOMIC_RELEASE);
+		++queued;
+	}
+
+	void Submit(unsigned waitFor) {	//hands the queued reads to the kernel and waits for waitFor of them to finish
+		while (queued || waitFor) {
+			long done = syscall(__NR_io_uring_enter, fd, queued, waitFor, waitFor ? IORING_ENTER_GETEVENTS : 0, nullptr, 0);
+			if (done < 0) {
+				if (errno == EINTR) continue;
+				throw std::runtime_error("io_uring_enter failed");
+			}
+			queued -= unsigned(done);
+			waitFor = 0;
+		}
+	}
+
+	template <typename F>
+	void Reap(F onComplete) {	//onComplete(buffer, result) for every finished read
+		unsigned head = *cqHead;
+		unsigned tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+		for (; head != tail; ++head) {
+			const io_uring_cqe& cqe = cqes[head & cqMask];
+			onComplete(unsigned(cqe.user_data), cqe.res);
+		}
+		__atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+	}
+
+private:
+	void* Map(size_t length, unsigned long long offset) {
+		void* mapped = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, off_t(offset));
+		return mapped == MAP_FAILED ? nullptr : mapped;
+	}
+
+	void Release() {
+		if (sqes) munmap(sqes, sqesSize);
+		if (cq && cq != sq) munmap(cq, cqSize);
+		if (sq) munmap(sq, sqSize);
+		close(fd);
+		sq = cq = nullptr;
+		sqes = nullptr;
+	}
+
+	int fd = -1;
+	void* sq = nullptr;
+	void* cq = nullptr;
+	io_uring_sqe* sqes = nullptr;
+	size_t sqSize = 0, cqSize = 0, sqesSize = 0;
+	unsigned* sqTail = nullptr;
+	unsigned sqMask = 0;
+	unsigned* sqArray = nullptr;
+	unsigned* cqHead = nullptr;
+	unsigned* cqTail = nullptr;
+	unsigned cqMask = 0;
+	io_uring_cqe* cqes = nullptr;
+	bool registered = false;
+	unsigned queued = 0;
+};
+
+void SumFilesUring(const std::vector<std::string>& paths, std::vector<FileJob>& jobs, const IngestOptions& options) {
+	struct Slot {
+		size_t job;
+		unsigned long long offset;
+		unsigned length;
+		unsigned got;
+		bool busy = false;
+		bool ready = false;
+	};
+	unsigned depth = std::max(1u, options.depth);
+	unsigned bufferSize = unsigned(std::max<size_t>(4096, std::min<size_t>(options.bufferSize, 1u << 30)));
+	std::vector<char> buffers(size_t(depth) * bufferSize);
+	std::vector<Slot> slots(depth);
+	Uring ring(depth, buffers.data(), bufferSize, depth);	//throws if the kernel doesn't have io_uring, before anything is read
+
+	size_t issuing = 0;	//files before this have had every read started
+	size_t feeding = 0;	//files before this are finished
+	try {
+		while (feeding < jobs.size()) {
+			for (unsigned s = 0; s < depth && issuing < jobs.size(); ++s) {	//start reads in every free buffer
+				if (slots[s].busy) continue;
+				while (issuing < jobs.size()) {
+					FileJob& job = jobs[issuing];
+					if (job.fd < 0 && !job.finished) OpenJob(paths[issuing], job);
+					if (job.nextRead < job.size) break;
+					++issuing;
+				}
+				if (issuing == jobs.size()) break;
+				FileJob& job = jobs[issuing];
+				Slot& slot = slots[s];
+				slot.job = issuing;
+				slot.offset = job.nextRead;
+				slot.length = unsigned(std::min<unsigned long long>(bufferSize, job.size - job.nextRead));
+				slot.got = 0;
+				slot.busy = true;
+				slot.ready = false;
+				job.nextRead += slot.length;
+				ring.Read(job.fd, s, buffers.data() + size_t(s) * bufferSize, slot.length, slot.offset);
+			}
+
+			for (size_t j = feeding; j < jobs.size() && j <= issuing; ++j) {	//feed every buffer that is next in its file
+				FileJob& job = jobs[j];
+				bool fed = true;
+				while (fed && job.nextFeed < job.size) {
+					fed = false;
+					for (unsigned s = 0; s < depth; ++s) {
+						Slot& slot = slots[s];
+						if (!slot.ready || slot.job != j || slot.offset != job.nextFeed) continue;
+						job.Feed(buffers.data() + size_t(s) * bufferSize, slot.got);
+						job.nextFeed += slot.got;
+						slot.busy = slot.ready = false;
+						fed = true;
+					}
+				}
+				if (!job.finished && job.fd >= 0 && job.nextFeed >= job.size && job.nextRead >= job.size) {
+					bool inFlight = false;	//a read started before a negative was found still owns a buffer
+					for (const Slot& slot : slots) inFlight = inFlight || (slot.busy && slot.job == j);
+					if (inFlight) continue;
+					job.Finish();
+					CloseJob(job);
+				}
+			}
+			while (feeding < jobs.size() && jobs[feeding].finished) ++feeding;
+			if (feeding == jobs.size()) break;
+
+			bool waiting = false;
+			for (const Slot& slot : slots) waiting = waiting || (slot.busy && !slot.ready);
+			ring.Submit(waiting ? 1 : 0);
+			ring.Reap([&](unsigned s, int result) {
+				Slot& slot = slots[s];
+				FileJob& job = jobs[slot.job];
+				if (result < 0) throw std::runtime_error("can't read " + paths[slot.job]);
+				slot.got += unsigned(result);
+				if (result == 0 || slot.offset + slot.got >= job.size) {	//the file got shorter since it was opened
+					if (slot.got < slot.length) job.size = job.nextRead = std::min(job.size, slot.offset + slot.got);
+					slot.ready = true;
+				}
+				else if (slot.got < slot.length) ring.Read(job.fd, s, buffers.data() + size_t(s) * bufferSize + slot.got, slot.length - slot.got, slot.offset + slot.got);	//short read, ask for the rest
+				else slot.ready = true;
+			});
+			for (Slot& slot : slots) {	//a buffer past the end of a file that got shorter is just given back
+				if (slot.ready && slot.offset >= jobs[slot.job].size) slot.busy = slot.ready = false;
+			}
+		}
+	}
+	catch (...) {
+		for (;;) {	//the kernel may still be writing into the buffers, wait for every read before they are freed
+			bool waiting = false;
+			for (const Slot& slot : slots) waiting = waiting || (slot.busy && !slot.ready);
+			if (!waiting) break;
+			try {
+				ring.Submit(1);
+			}
+			catch (std::runtime_error&) {
+				break;
+			}
+			ring.Reap([&](unsigned s, int) { slots[s].ready = true; });
+		}
+		for (FileJob& job : jobs) CloseJob(job);
+		throw;
+	}
+}
+#endif
+
+void SumFilesRead(const std::vector<std::string>& paths, std::vector<FileJob>& jobs, const IngestOptions& options) {
+	std::vector<char> buffer(std::max<size_t>(options.bufferSize, 1));
+	for (size_t j = 0; j < jobs.size(); ++j) {
+		if (jobs[j].finished) continue;
+		FILE* file = std::fopen(paths[j].c_str(), "rb");
+		if (!file) throw std::runtime_error("can't open " + paths[j]);
+		size_t got;
+		while (jobs[j].result.ok && (got = std::fread(buffer.data(), 1, buffer.size(), file)) > 0) jobs[j].Feed(buffer.data(), got);
+		std::fclose(file);
+		jobs[j].Finish();
+	}
+}
+
+std::vector<FileSum> SumFiles(const std::vector<std::string>& paths, const IngestOptions& options = IngestOptions(), IngestBackend* used = nullptr) {
+	std::vector<FileJob> jobs(paths.size());
+	IngestBackend backend = IngestRead;
+#ifdef __linux__
+	if (options.allowUring) {
+		try {
+			SumFilesUring(paths, jobs, options);
+			backend = IngestUring;
+		}
+		catch (std::runtime_error&) {
+			bool started = false;	//only fall back if io_uring couldn't be set up at all
+			for (const FileJob& job : jobs) started = started || job.result.bytes || job.finished;
+			if (started) throw;
+			jobs.assign(paths.size(), FileJob());
+		}
+	}
+#endif
+	if (backend == IngestRead) SumFilesRead(paths, jobs, options);
+	if (used) *used = backend;
+
+	std::vector<FileSum> results;
+	for (const FileJob& job : jobs) results.push_back(job.result);
+	return results;
+}
+
+int main()
+{
+	try{
+
+		std::cout << "Accepts the following syntax:\n**\nstring-of-numbers\n**\n[delimiter]\n[more delimiters...]\nstring-of-numbers\n**\n";
+		const char* contents[] = { "1,2,3", "[;]23;/4;;7", "[\n]3\n9\n-1\n4" };
+		std::vector<std::string> paths;
+		for (int i = 0; i < 3; ++i) {
+			paths.push_back("ingest" + std::to_string(i) + ".txt");
+			std::ofstream(paths.back(), std::ios::binary) << contents[i];
+		}
+
+		IngestBackend used;
+		for (const FileSum& file : SumFiles(paths, IngestOptions(), &used)) std::cout << file.ok << ':' << (file.ok ? file.sum : file.negative) << ' ';
+		std::cout << '\n';
+		std::cout << (used == IngestUring ? "io_uring" : "read") << '\n';
+		for (const std::string& path : paths) std::remove(path.c_str());
+
+		//Expected output:
+		//1:6 1:30 0:-1
+		//io_uring. read where the kernel doesn't have it
+	}
+	catch (std::exception& e) {
+		std::cerr << "Exception: " << e.what() << '\n';
+	}
+	system("pause");	//prevent cmd window from closing on windows
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,525 @@
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <climits>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#ifdef TDD_WITH_ZLIB
+#include <zlib.h>
+#endif
+#ifdef TDD_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//22.
+//Sum gzip or zstd compressed input without writing the uncompressed copy to disk first. One thread decompresses into a ring of
+//buffers while the streaming scan reads them on the calling thread, so decompressing and adding overlap
+// - Added Decoder with IdentityDecoder, GzipDecoder (define TDD_WITH_ZLIB and link zlib) and ZstdDecoder (define TDD_WITH_ZSTD and
+//	 link zstd). OpenDecoder() picks one from the first bytes of the input unless DecompressOptions says which
+// - Added BufferRing, a fixed number of buffers passed between the two threads, and AddCompressed() which gives the same result as Add()
+//	 on the decompressed text. A decompression error is thrown on the calling thread, a negative stops the decompression thread
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+struct StreamState {	//everything a streamed scan needs to carry on with the next piece
+	int stage = 0;	//0 nothing read yet, 1 reading delimiters, 2 reading numbers
+	bool usingDelim = false;
+	std::vector<std::string> delimiters;
+	size_t maxDelim = 1;
+	std::string pending;	//bytes we can't decide on until more arrive
+	std::string substring;	//the number being read
+	unsigned long long offset = 0;	//stream offset of pending.front()
+	unsigned long long tokenStart = 0;	//stream offset of substring.front()
+};
+
+//Reads the next piece of the stream, calling onToken(substring, offset) for every number that is known to have ended.
+//final means nothing else is coming, so nothing is held back
+template <typename F>
+void StreamFeed(StreamState& state, const char* data, size_t size, F onToken, bool final = false) {
+	std::string& pending = state.pending;
+	pending.append(data, size);
+	size_t i = 0;
+
+	if (state.stage == 0 && pending.size()) {	//the first character decides if there are delimiters, like the top of Add()
+		state.usingDelim = !isdigit(pending.front());
+		state.stage = state.usingDelim ? 1 : 2;
+		if (state.usingDelim) state.delimiters.assign(1, "");
+	}
+
+	while (state.stage == 1 && i < pending.size()) {
+		if (pending[i] == '[') {
+			++i;
+			continue;
+		}
+		if (pending[i] == ']') {
+			if ((i + 1) >= pending.size() && !final) break;	//need the next character to know if another delim follows
+			if ((i + 1) < pending.size() && pending[i + 1] != '[') {
+				state.stage = 2;
+				for (const std::string& delim : state.delimiters) state.maxDelim = std::max(state.maxDelim, delim.size());
+			}
+			else state.delimiters.push_back("");
+			++i;
+			continue;
+		}
+		state.delimiters[state.delimiters.size() - 1] += pending[i++];
+	}
+
+	while (state.stage == 2 && i < pending.size()) {
+		size_t delimLength = 0;
+		if (!state.usingDelim) delimLength = isdigit(pending[i]) ? 0 : 1;
+		else {
+			if (pending.size() - i < state.maxDelim && !final) break;	//a delim might start here and end in the next piece
+			for (const std::string& delim : state.delimiters) {
+				if (delim.size() && pending[i] == delim.front() && pending.compare(i, delim.size(), delim) == 0) {
+					delimLength = delim.size();
+					break;
+				}
+			}
+		}
+
+		if (delimLength) {
+			if (state.substring != "") {
+				onToken(state.substring, state.tokenStart);
+				state.substring = "";
+			}
+			i += delimLength;
+		}
+		else {
+			if (state.substring == "") state.tokenStart = state.offset + i;
+			state.substring += pending[i++];
+		}
+	}
+
+	pending.erase(0, i);
+	state.offset += i;
+}
+
+template <typename F>
+void StreamFinish(StreamState& state, F onToken) {	//end of the stream, hands out whatever was held back
+	StreamFeed(state, nullptr, 0, onToken, true);
+	if (state.substring != "") {
+		onToken(state.substring, state.tokenStart);
+		state.substring = "";
+	}
+}
+
+enum Compression { CompressionDetect, CompressionNone, CompressionGzip, CompressionZstd };
+
+class Decoder {	//turns the compressed stream into plain text
+public:
+	virtual ~Decoder() {}
+	virtual size_t Read(char* out, size_t size) = 0;	//fills out with up to size bytes, 0 once the input has ended
+};
+
+class CompressedInput {	//the input, starting with the bytes OpenDecoder() already looked at
+public:
+	CompressedInput(std::istream& in, const std::string& start) :in(in), start(start) {}
+
+	size_t Read(char* out, size_t size) {
+		size_t length = std::min(size, start.size() - used);
+		std::copy(start.begin() + used, start.begin() + used + length, out);
+		used += length;
+		if (length < size) {
+			in.read(out + length, std::streamsize(size - length));
+			length += size_t(in.gcount());
+		}
+		return length;
+	}
+
+private:
+	std::istream& in;
+	std::string start;
+	size_t used = 0;
+};
+
+class IdentityDecoder : public Decoder {	//input that isn't compressed
+public:
+	IdentityDecoder(std::istream& in, const std::string& start) :input(in, start) {}
+
+	size_t Read(char* out, size_t size) override { return input.Read(out, size); }
+
+private:
+	CompressedInput input;
+};
+
+#ifdef TDD_WITH_ZLIB
+class GzipDecoder : public Decoder {	//also reads zlib streams, and gzip files made of several members
+public:
+	GzipDecoder(std::istream& in, const std::string& start) :input(in, start), buffer(64 << 10), stream(z_stream()) {
+		if (inflateInit2(&stream, 15 + 32) != Z_OK) throw std::runtime_error("can't start zlib");	//+32 reads either header
+	}
+	~GzipDecoder() { inflateEnd(&stream); }
+
+	size_t Read(char* out, size_t size) override {
+		stream.next_out = reinterpret_cast<Bytef*>(out);
+		stream.avail_out = uInt(std::min<size_t>(size, UINT_MAX));
+		while (stream.avail_out) {
+			if (stream.avail_in == 0) {
+				stream.avail_in = uInt(input.Read(buffer.data(), buffer.size()));
+				stream.next_in = reinterpret_cast<Bytef*>(buffer.data());
+				if (stream.avail_in == 0) {
+					if (inMember) throw std::runtime_error("gzip input ends in the middle");
+					break;
+				}
+			}
+			inMember = true;
+			int result = inflate(&stream, Z_NO_FLUSH);
+			if (result == Z_STREAM_END) {
+				inMember = false;
+				inflateReset(&stream);
+			}
+			else if (result != Z_OK && result != Z_BUF_ERROR) throw std::runtime_error("corrupt gzip input");
+		}
+		return size - stream.avail_out;
+	}
+
+private:
+	CompressedInput input;
+	std::vector<char> buffer;
+	z_stream stream;
+	bool inMember = false;
+};
+#endif
+
+#ifdef TDD_WITH_ZSTD
+class ZstdDecoder : public Decoder {
+public:
+	ZstdDecoder(std::istream& in, const std::string& start) :input(in, start), buffer(ZSTD_DStreamInSize()), stream(ZSTD_createDStream()) {
+		if (!stream) throw std::runtime_error("can't start zstd");
+		ZSTD_initDStream(stream);
+	}
+	~ZstdDecoder() { ZSTD_freeDStream(stream); }
+
+	size_t Read(char* out, size_t size) override {
+		ZSTD_outBuffer output = { out, size, 0 };
+		while (output.pos < output.size) {
+			if (pending.pos == pending.size) {
+				pending = ZSTD_inBuffer{ buffer.data(), input.Read(buffer.data(), buffer.size()), 0 };
+				if (pending.size == 0) {
+					if (inFrame) throw std::runtime_error("zstd input ends in the middle");
+					break;
+				}
+			}
+			size_t result = ZSTD_decompressStream(stream, &output, &pending);
+			if (ZSTD_isError(result)) throw std::runtime_error(std::string("corrupt zstd input: ") + ZSTD_getErrorName(result));
+			inFrame = result != 0;	//0 means a frame just ended
+		}
+		return output.pos;
+	}
+
+private:
+	CompressedInput input;
+	std::vector<char> buffer;
+	ZSTD_DStream* stream;
+	ZSTD_inBuffer pending = { nullptr, 0, 0 };
+	bool inFrame = false;
+};
+#endif
+
+std::unique_ptr<Decoder> OpenDecoder(std::istream& in, Compression compression = CompressionDetect) {
+	char magic[4] = {};
+	in.read(magic, 4);
+	std::string start(magic, size_t(in.gcount()));
+	if (compression == CompressionDetect) {
+		compression = CompressionNone;
+		if (start.size() >= 2 && start[0] == '\x1f' && start[1] == '\x8b') compression = CompressionGzip;
+		if (start == "\x28\xb5\x2f\xfd") compression = CompressionZstd;
+	}
+
+	switch (compression) {
+#ifdef TDD_WITH_ZLIB
+	case CompressionGzip: return std::unique_ptr<Decoder>(new GzipDecoder(in, start));
+#endif
+#ifdef TDD_WITH_ZSTD
+	case CompressionZstd: return std::unique_ptr<Decoder>(new ZstdDecoder(in, start));
+#endif
+	case CompressionNone: return std::unique_ptr<Decoder>(new IdentityDecoder(in, start));
+	default: throw std::runtime_error("this build can't read that compression");
+	}
+}
+
+class BufferRing {	//full buffers go from the decompression thread to the scan and come back empty
+public:
+	BufferRing(unsigned count, size_t size) :buffers(std::max(count, 2u), std::vector<char>(std::max<size_t>(size, 1))), lengths(buffers.size()) {
+		for (unsigned i = 0; i < buffers.size(); ++i) empty.push_back(i);
+	}
+
+	char* Data(unsigned buffer) { return buffers[buffer].data(); }
+	size_t Capacity() const { return buffers.front().size(); }
+
+	bool TakeEmpty(unsigned& buffer) {	//false once the scan has stopped
+		std::unique_lock<std::mutex> lock(mutex);
+		changed.wait(lock, [this]() { return empty.size() || cancelled; });
+		if (cancelled) return false;
+		buffer = empty.front();
+		empty.pop_front();
+		return true;
+	}
+
+	void PushFull(unsigned buffer, size_t length) {
+		std::lock_guard<std::mutex> lock(mutex);
+		lengths[buffer] = length;
+		full.push_back(buffer);
+		changed.notify_all();
+	}
+
+	bool TakeFull(unsigned& buffer, size_t& length) {	//false at the end of the input, throws what the decompression thread threw
+		std::unique_lock<std::mutex> lock(mutex);
+		changed.wait(lock, [this]() { return full.size() || finished; });
+		if (full.empty()) {
+			if (error) std::rethrow_exception(error);
+			return false;
+		}
+		buffer = full.front();
+		full.pop_front();
+		length = lengths[buffer];
+		return true;
+	}
+
+	void GiveBack(unsigned buffer) {
+		std::lock_guard<std::mutex> lock(mutex);
+		empty.push_back(buffer);
+		changed.notify_all();
+	}
+
+	void Finish(std::exception_ptr failure = nullptr) {	//the decompression thread has nothing more
+		std::lock_guard<std::mutex> lock(mutex);
+		finished = true;
+		error = failure;
+		changed.notify_all();
+	}
+
+	void Cancel() {	//the scan has stopped
+		std::lock_guard<std::mutex> lock(mutex);
+		cancelled = true;
+		changed.notify_all();
+	}
+
+private:
+	std::vector<std::vector<char>> buffers;
+	std::vector<size_t> lengths;
+	std::deque<unsigned> empty, full;
+	std::mutex mutex;
+	std::condition_variable changed;
+	bool finished = false;
+	bool cancelled = false;
+	std::exception_ptr error;
+};
+
+struct DecompressOptions {
+	Compression compression = CompressionDetect;
+	size_t bufferSize = 64 << 10;
+	unsigned buffers = 4;
+};
+
+int AddCompressed(std::istream& in, const DecompressOptions& options = DecompressOptions()) {
+	std::unique_ptr<Decoder> decoder = OpenDecoder(in, options.compression);
+	BufferRing ring(options.buffers, options.bufferSize);
+	std::thread decompressor([&]() {
+		try {
+			unsigned buffer;
+			while (ring.TakeEmpty(buffer)) {
+				size_t length = decoder->Read(ring.Data(buffer), ring.Capacity());
+				if (length == 0) break;
+				ring.PushFull(buffer, length);
+			}
+			ring.Finish();
+		}
+		catch (...) {
+			ring.Finish(std::current_exception());
+		}
+	});
+
+	StreamState state;
+	int sum = 0;
+	auto onToken = [&sum](const std::string& substring, unsigned long long) { sum += StringToNumber<int>(substring); };
+	try {
+		unsigned buffer;
+		size_t length;
+		while (ring.TakeFull(buffer, length)) {
+			StreamFeed(state, ring.Data(buffer), length, onToken);
+			ring.GiveBack(buffer);
+		}
+		StreamFinish(state, onToken);
+	}
+	catch (...) {
+		ring.Cancel();
+		decompressor.join();
+		throw;
+	}
+	decompressor.join();
+	return sum;
+}
+
+int AddCompressed(const std::string& path, const DecompressOptions& options = DecompressOptions()) {
+	std::ifstream in(path, std::ios::binary);
+	if (!in) throw std::runtime_error("can't open " + path);
+	return AddCompressed(in, options);
+}
+
+int main()
+{
+	try{
+
+		std::cout << "Accepts the following syntax:\n**\nstring-of-numbers\n**\n[delimiter]\n[more delimiters...]\nstring-of-numbers\n**\n";
+		std::istringstream plain("[;]23;/4;;7");
+		std::cout << AddCompressed(plain) << '\n';
+
+#ifdef TDD_WITH_ZLIB
+		const unsigned char gzip[] = {	//"1,2,3\n" compressed with gzip
+			0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0xd4, 0x31, 0xd2, 0x31, 0xe6,
+			0x02, 0x00, 0x2e, 0xb4, 0x1e, 0x05, 0x06, 0x00, 0x00, 0x00 };
+		std::istringstream compressed(std::string(reinterpret_cast<const char*>(gzip), sizeof(gzip)));
+		std::cout << AddCompressed(compressed) << '\n';
+#endif
+
+		//Expected output:
+		//30
+		//6. when built with TDD_WITH_ZLIB
+	}
+	catch (std::exception& e) {
+		std::cerr << "Exception: " << e.what() << '\n';
+	}
+	system("pause");	//prevent cmd window from closing on windows
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,433 @@
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include "stringcalc.h"
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//26.
+//Make the calculator callable from other languages without copying into a std::string or throwing across the boundary. Export an
+//extern "C" API over (const char*, size_t), with batch calls over arrays of pointer and length pairs, status codes instead of
+//exceptions and opaque context handles that are reused between calls
+// - Added stringcalc.h and the functions it declares. Build this file with STRINGCALC_LIBRARY defined to make libstringcalc, which
+//	 leaves out main(). Everything else is in an anonymous namespace so the library only exports the stringcalc_ functions
+// - Inputs are read in place with the Step 12 tokens. A context keeps the last header's parsed delimiters so inputs that share a
+//	 header don't parse it again, and the message of the last error
+
+namespace {	//only the extern "C" functions below are exported from libstringcalc
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+inline int Add(std::string numbers) {	//inline, as only main() and the tests call it and an unused function in the namespace is a warning
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+struct DelimSpec {
+	bool usingDelim = false;	//false means any non digit splits numbers
+	std::vector<std::string> delimiters;
+	size_t bodyStart = 0;	//offset of the first character after the delimiter declarations
+};
+
+DelimSpec ParseDelimSpec(const char* numbers, size_t size) {	//reads the delimiters the same way as the top of Add()
+	DelimSpec spec;
+	if (size == 0 || isdigit(numbers[0])) return spec;
+
+	spec.usingDelim = true;
+	spec.delimiters.push_back("");
+	size_t i = 0;
+	for (; i < size; ++i) {
+		if (numbers[i] == '[') continue;
+		if (numbers[i] == ']') {
+			if ((i + 1) < size && numbers[i + 1] != '[') {
+				++i;
+				break;
+			}
+			spec.delimiters.push_back("");
+			continue;
+		}
+		spec.delimiters[spec.delimiters.size() - 1] += numbers[i];
+	}
+	spec.bodyStart = i;
+	return spec;
+}
+
+inline DelimSpec ParseDelimSpec(const std::string& numbers) {
+	return ParseDelimSpec(numbers.data(), numbers.size());
+}
+
+int ParseTokenValue(const char* first, const char* last) {	//same result as reading an int from a stringstream, without the copy
+	while (first != last && (*first == ' ' || (*first >= '\t' && *first <= '\r'))) ++first;	//stringstream skips leading whitespace
+	bool negative = false;
+	if (first != last && (*first == '-' || *first == '+')) negative = *first++ == '-';
+	long long value = 0;
+	for (; first != last && *first >= '0' && *first <= '9'; ++first) {
+		value = value * 10 + (*first - '0');
+		if (value > 1LL + INT_MAX) value = 1LL + INT_MAX;	//out of range, stringstream gives back INT_MAX or INT_MIN
+	}
+	if (negative) return value > INT_MAX ? INT_MIN : int(-value);
+	return value > INT_MAX ? INT_MAX : int(value);
+}
+
+struct Token {
+	int value;	//converted without the Step 5 and 6 rules, so negatives and numbers over 1000 come through as they are
+	size_t offset;
+	size_t length;
+};
+
+class TokenIterator {
+public:
+	using iterator_category = std::input_iterator_tag;
+	using iterator_concept = std::forward_iterator_tag;
+	using value_type = Token;
+	using difference_type = std::ptrdiff_t;
+	using pointer = void;
+	using reference = Token;
+
+	TokenIterator() = default;
+	TokenIterator(const char* data, size_t size, const DelimSpec* spec) :data(data), size(size), spec(spec), position(spec->bodyStart), atEnd(false) {
+		Next();
+	}
+
+	Token operator*() const { return current; }
+	TokenIterator& operator++() { Next(); return *this; }
+	TokenIterator operator++(int) { TokenIterator before = *this; Next(); return before; }
+
+	bool operator==(const TokenIterator& other) const {
+		return atEnd == other.atEnd && (atEnd || current.offset == other.current.offset);
+	}
+	bool operator!=(const TokenIterator& other) const { return !(*this == other); }
+
+private:
+	size_t DelimAt(size_t i) const {	//length of the delimiter found at i, 0 if i is part of a number
+		if (!spec->usingDelim) return (data[i] >= '0' && data[i] <= '9') ? 0 : 1;
+		for (const std::string& delim : spec->delimiters) {
+			if (delim.empty() || data[i] != delim.front() || size - i < delim.size()) continue;
+			if (std::memcmp(data + i, delim.data(), delim.size()) == 0) return delim.size();
+		}
+		return 0;
+	}
+
+	void Next() {
+		size_t length;
+		while (position < size && (length = DelimAt(position)) != 0) position += length;	//skip delimiters until a number starts
+		if (position >= size) {
+			atEnd = true;
+			return;
+		}
+		size_t start = position;
+		while (position < size && DelimAt(position) == 0) ++position;
+		current.offset = start;
+		current.length = position - start;
+		current.value = ParseTokenValue(data + start, data + position);
+	}
+
+	const char* data = nullptr;
+	size_t size = 0;
+	const DelimSpec* spec = nullptr;
+	size_t position = 0;
+	Token current = Token();
+	bool atEnd = true;	//a default constructed iterator is an end iterator
+};
+
+class TokenRange {
+public:
+	TokenRange() = default;
+	TokenRange(const char* data, size_t size, const DelimSpec& spec) :data(data), size(size), spec(&spec) {}
+
+	TokenIterator begin() const { return spec ? TokenIterator(data, size, spec) : TokenIterator(); }
+	TokenIterator end() const { return TokenIterator(); }
+
+private:
+	const char* data = nullptr;
+	size_t size = 0;
+	const DelimSpec* spec = nullptr;
+};
+
+//The range points into input and spec, both have to outlive it
+TokenRange tokens(const char* data, size_t size, const DelimSpec& spec) {
+	return TokenRange(data, size, spec);
+}
+
+inline TokenRange tokens(const std::string& input, const DelimSpec& spec) {
+	return TokenRange(input.data(), input.size(), spec);
+}
+
+}
+
+struct stringcalc_context {	//declared in stringcalc.h, so it can't be in the namespace
+	std::string header;	//header of the last input with delimiters, parsed into spec
+	DelimSpec spec;
+	std::string error;	//what stringcalc_last_error() gives back
+};
+
+namespace {
+
+const DelimSpec& SpecFor(stringcalc_context& context, const char* data, size_t size) {	//only parses the header when it isn't the last one
+	static const DelimSpec noDelimiters;
+	if (size == 0 || isdigit(data[0])) return noDelimiters;
+
+	const std::string& header = context.header;	//ends in a ] that isn't followed by [, so the same bytes always give the same delimiters
+	if (header.size() && size > header.size() && data[header.size()] != '[' && std::memcmp(data, header.data(), header.size()) == 0) return context.spec;
+	context.spec = ParseDelimSpec(data, size);
+	if (context.spec.bodyStart < size) context.header.assign(data, context.spec.bodyStart);
+	else context.header.clear();
+	return context.spec;
+}
+
+stringcalc_status Evaluate(stringcalc_context& context, const char* data, size_t size, int32_t& value) {	//same as Add(), negatives are a status
+	int sum = 0;
+	for (Token token : tokens(data, size, SpecFor(context, data, size))) {
+		if (token.value < 0) {
+			value = token.value;
+			return STRINGCALC_NEGATIVE;
+		}
+		if (token.value <= 1000) sum += token.value;
+	}
+	value = sum;
+	return STRINGCALC_OK;
+}
+
+stringcalc_status Fail(stringcalc_context* context, stringcalc_status status, const std::string& message) {
+	if (context) context->error = message;
+	return status;
+}
+
+template <typename F>
+stringcalc_status Guarded(stringcalc_context* context, F call) {	//nothing may be thrown out of an extern "C" function
+	try {
+		return call();
+	}
+	catch (std::bad_alloc&) {
+		return Fail(context, STRINGCALC_OUT_OF_MEMORY, "out of memory");
+	}
+	catch (std::exception& e) {
+		return Fail(context, STRINGCALC_INTERNAL_ERROR, e.what());
+	}
+	catch (...) {
+		return Fail(context, STRINGCALC_INTERNAL_ERROR, "unknown error");
+	}
+}
+
+}
+
+extern "C" {
+
+uint32_t stringcalc_abi_version(void) {
+	return STRINGCALC_ABI_VERSION;
+}
+
+stringcalc_status stringcalc_context_create(stringcalc_context** context) {
+	if (!context) return STRINGCALC_INVALID_ARGUMENT;
+	*context = new (std::nothrow) stringcalc_context();
+	return *context ? STRINGCALC_OK : STRINGCALC_OUT_OF_MEMORY;
+}
+
+void stringcalc_context_destroy(stringcalc_context* context) {
+	delete context;
+}
+
+stringcalc_status stringcalc_add(stringcalc_context* context, const char* data, size_t size, int32_t* value) {
+	if (!context || !value || (!data && size)) return Fail(context, STRINGCALC_INVALID_ARGUMENT, "null argument");
+	return Guarded(context, [&]() {
+		stringcalc_status status = Evaluate(*context, data, size, *value);
+		if (status == STRINGCALC_NEGATIVE) context->error = NegativeNumberException(*value).what();
+		return status;
+	});
+}
+
+stringcalc_status stringcalc_add_batch(stringcalc_context* context, const stringcalc_buffer* inputs, size_t count, stringcalc_result* results) {
+	if (!context || (count && (!inputs || !results))) return Fail(context, STRINGCALC_INVALID_ARGUMENT, "null argument");
+	return Guarded(context, [&]() {
+		for (size_t i = 0; i < count; ++i) {
+			const stringcalc_buffer& input = inputs[i];
+			results[i].value = 0;
+			results[i].status = (!input.data && input.size) ? STRINGCALC_INVALID_ARGUMENT : Evaluate(*context, input.data, input.size, results[i].value);
+		}
+		return STRINGCALC_OK;
+	});
+}
+
+const char* stringcalc_status_message(stringcalc_status status) {
+	switch (status) {
+	case STRINGCALC_OK: return "ok";
+	case STRINGCALC_NEGATIVE: return "negative numbers not allowed";
+	case STRINGCALC_INVALID_ARGUMENT: return "invalid argument";
+	case STRINGCALC_OUT_OF_MEMORY: return "out of memory";
+	case STRINGCALC_INTERNAL_ERROR: return "internal error";
+	default: return "unknown status";
+	}
+}
+
+const char* stringcalc_last_error(const stringcalc_context* context) {
+	return context ? context->error.c_str() : "";
+}
+
+}
+
+#ifndef STRINGCALC_LIBRARY
+int main()
+{
+	try{
+
+		std::cout << "Accepts the following syntax:\n**\nstring-of-numbers\n**\n[delimiter]\n[more delimiters...]\nstring-of-numbers\n**\n";
+		stringcalc_context* context;
+		stringcalc_context_create(&context);
+		const char numbers[] = "[;]23;/4;;7";
+		int32_t value;
+		stringcalc_status status = stringcalc_add(context, numbers, sizeof(numbers) - 1, &value);
+		std::cout << stringcalc_status_message(status) << ' ' << value << '\n';
+
+		stringcalc_buffer inputs[] = { { "1,2", 3 }, { "[\n]3\n9\n-1", 10 }, { nullptr, 0 } };
+		stringcalc_result results[3];
+		stringcalc_add_batch(context, inputs, 3, results);
+		for (const stringcalc_result& result : results) std::cout << result.status << ':' << result.value << ' ';
+		std::cout << '\n';
+
+		stringcalc_add(context, "[;]5;-6", 7, &value);
+		std::cout << stringcalc_last_error(context) << '\n';
+		stringcalc_context_destroy(context);
+
+		//Expected output:
+		//ok 30
+		//0:3 1:-1 0:0
+		//Negative numbers not allowed! (-6)
+	}
+	catch (std::exception& e) {
+		std::cerr << "Exception: " << e.what() << '\n';
+	}
+	system("pause");	//prevent cmd window from closing on windows
+    return 0;
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,321 @@
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <climits>
+#include <cstring>
+#include <random>
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//31.
+//Check an input before it is queued without working out the sum. Report whether the delimiter declarations are usable and where every
+//negative number that Add() would throw for starts, going through the input at close to the speed of a memcpy
+// - Added Validate(), which finds each '-' with memchr() and only looks closer at the ones followed by a digit other than 0.
+//	 Without delimiters a '-' always splits numbers, so only the header is checked
+// - The delimiters are only matched near a '-', from the last place they were matched or the last byte no delimiter contains
+// - Added HeaderStatus. Unterminated means the declarations run to the end so there are no numbers and Add() gives 0, which is accepted.
+//	 EmptyDelimiter is a "[]" before the numbers, which Add() can't match and isn't accepted
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+struct DelimSpec {
+	bool usingDelim = false;	//false means any non digit splits numbers
+	std::vector<std::string> delimiters;
+	size_t bodyStart = 0;	//offset of the first character after the delimiter declarations
+};
+
+DelimSpec ParseDelimSpec(const char* numbers, size_t size) {	//reads the delimiters the same way as the top of Add()
+	DelimSpec spec;
+	if (size == 0 || isdigit(numbers[0])) return spec;
+
+	spec.usingDelim = true;
+	spec.delimiters.push_back("");
+	size_t i = 0;
+	for (; i < size; ++i) {
+		if (numbers[i] == '[') continue;
+		if (numbers[i] == ']') {
+			if ((i + 1) < size && numbers[i + 1] != '[') {
+				++i;
+				break;
+			}
+			spec.delimiters.push_back("");
+			continue;
+		}
+		spec.delimiters[spec.delimiters.size() - 1] += numbers[i];
+	}
+	spec.bodyStart = i;
+	return spec;
+}
+
+DelimSpec ParseDelimSpec(const std::string& numbers) {
+	return ParseDelimSpec(numbers.data(), numbers.size());
+}
+
+enum class HeaderStatus {
+	None,	//no delimiters declared, any non digit splits numbers
+	Ok,
+	Unterminated,	//no ']' followed by something other than '[', everything is read as delimiters and the sum is 0
+	EmptyDelimiter	//"[]", which would match nothing
+};
+
+struct ValidationResult {
+	HeaderStatus header = HeaderStatus::None;
+	std::vector<size_t> negatives;	//offset of the '-' of each number Add() would throw for, in order
+
+	bool Ok() const { return header != HeaderStatus::EmptyDelimiter && negatives.empty(); }
+};
+
+bool IsSpace(char c) {	//what a stringstream skips before a number
+	return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+class NegativeScanner {	//matches delimiters the same way as Add(), but only around the places a negative could start
+public:
+	NegativeScanner(const char* data, size_t size, const DelimSpec& spec) :data(data), size(size), spec(spec), pos(spec.bodyStart) {
+		for (const std::string& delim : spec.delimiters) {
+			for (char c : delim) inDelim[(unsigned char)c] = true;
+		}
+	}
+
+	//minus is a '-' followed by a digit that isn't 0, true if it starts a number. Calls must come in order
+	bool StartsNegative(size_t minus) {
+		size_t k = minus;	//back over whitespace no delimiter uses, a delimiter can't end in it
+		while (k > pos && IsSpace(data[k - 1]) && !inDelim[(unsigned char)data[k - 1]]) --k;
+		if (k > pos && !inDelim[(unsigned char)data[k - 1]]) return false;	//something else comes first in the same number
+		if (k == pos) {
+			if (!blank) return false;
+		}
+		else {	//a delimiter may end right before, match them from the nearest place that is known to be between matches
+			size_t sync = k - 1;
+			while (sync > pos && (inDelim[(unsigned char)data[sync - 1]] || IsSpace(data[sync - 1]))) --sync;
+			if (sync > pos) {
+				pos = sync;	//data[sync - 1] is in no delimiter and isn't whitespace, so it is inside a number
+				blank = false;
+			}
+			while (pos < minus) Step();
+			if (pos > minus || !blank) return false;	//the '-' is part of a delimiter, or the number didn't start with it
+		}
+
+		if (Match(minus)) return false;	//"-" is a delimiter
+		pos = minus + 1;
+		blank = false;
+		bool nonZero = false;
+		for (; pos < size && data[pos] >= '0' && data[pos] <= '9' && !Match(pos); ++pos) nonZero = nonZero || data[pos] != '0';
+		return nonZero;
+	}
+
+private:
+	size_t Match(size_t i) const {	//length of the first delimiter at i, 0 if none
+		for (const std::string& delim : spec.delimiters) {
+			if (delim.size() && size - i >= delim.size() && std::memcmp(data + i, delim.data(), delim.size()) == 0) return delim.size();
+		}
+		return 0;
+	}
+
+	void Step() {
+		if (size_t length = Match(pos)) {
+			pos += length;
+			blank = true;
+		}
+		else blank = IsSpace(data[pos++]) && blank;
+	}
+
+	const char* data;
+	size_t size;
+	const DelimSpec& spec;
+	bool inDelim[256] = {};
+	size_t pos;	//delimiters have been matched up to here
+	bool blank = true;	//the number that pos is in is only whitespace so far
+};
+
+HeaderStatus CheckHeader(size_t size, const DelimSpec& spec) {
+	if (!spec.usingDelim) return HeaderStatus::None;
+	if (spec.bodyStart == size) return HeaderStatus::Unterminated;	//a header that ends has something after it
+	for (const std::string& delim : spec.delimiters) {
+		if (delim.empty()) return HeaderStatus::EmptyDelimiter;
+	}
+	return HeaderStatus::Ok;
+}
+
+//Whether Add() would accept the input, without converting any numbers. Stops after limit negatives are found
+ValidationResult Validate(const char* numbers, size_t size, size_t limit = SIZE_MAX) {
+	ValidationResult result;
+	DelimSpec spec = ParseDelimSpec(numbers, size);
+	result.header = CheckHeader(size, spec);
+	if (result.header != HeaderStatus::Ok) return result;	//without a header or a body there are no negatives, and "[]" can't be read
+
+	NegativeScanner scanner(numbers, size, spec);
+	const char* end = numbers + size;
+	for (const char* minus = numbers + spec.bodyStart; result.negatives.size() < limit; ++minus) {
+		minus = static_cast<const char*>(std::memchr(minus, '-', end - minus));
+		if (!minus) break;
+		const char* digit = minus + 1;
+		while (digit != end && *digit == '0') ++digit;
+		if (digit == end || *digit < '1' || *digit > '9') continue;	//-0 is 0, and without a digit it is 0 too
+		if (scanner.StartsNegative(minus - numbers)) result.negatives.push_back(minus - numbers);
+	}
+	return result;
+}
+
+ValidationResult Validate(const std::string& numbers) {
+	return Validate(numbers.data(), numbers.size());
+}
+
+int main()
+{
+	try{
+
+		std::cout << "Accepts the following syntax:\n**\nstring-of-numbers\n**\n[delimiter]\n[more delimiters...]\nstring-of-numbers\n**\n";
+		std::string inputs[] = { "1,-2,3", "[;]1;-2;-0;3- 4;-5", "[;][--]1--2;--3", "[;]1;2", "[;][]1", ";1;2" };
+		for (const std::string& input : inputs) {
+			ValidationResult result = Validate(input);
+			std::cout << result.Ok() << ' ' << int(result.header);
+			for (size_t offset : result.negatives) std::cout << ' ' << offset;
+			std::cout << '\n';
+		}
+
+		//Expected output:
+		//1 0	(no delimiters, so the '-' splits numbers and Add() gives 6)
+		//0 1 5 16	(-0 is 0 and "3- 4" reads as 3)
+		//1 1	(each "--" is a delimiter)
+		//1 1
+		//0 3
+		//1 2	(everything is read as delimiters, so Add() gives 0)
+	}
+	catch (std::exception& e) {
+		std::cerr << "Exception: " << e.what() << '\n';
+	}
+	system("pause");	//prevent cmd window from closing on windows
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,584 @@
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//32.
+//Let a new process start with the delimiters it had already worked out. Compiled delimiter declarations are saved to a versioned file
+//that is mapped straight into memory and checked when it is opened, and are found by a hash of the declarations at the front of an input
+// - Added CompileSpec(), which turns the declarations into a flat record: the delimiters in list order and which bytes they start with
+// - Added SaveSpecStore(), which writes the records behind an open addressing table of header hashes and a checksum
+// - Added SpecStore, which maps the file and throws if it is from another version, cut short, or doesn't match its checksum
+// - Added SpecCache and AddCompiled(). Headers missing from the store are compiled once and kept, so the next save includes them
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+struct DelimSpec {
+	bool usingDelim = false;	//false means any non digit splits numbers
+	std::vector<std::string> delimiters;
+	size_t bodyStart = 0;	//offset of the first character after the delimiter declarations
+};
+
+DelimSpec ParseDelimSpec(const char* numbers, size_t size) {	//reads the delimiters the same way as the top of Add()
+	DelimSpec spec;
+	if (size == 0 || isdigit(numbers[0])) return spec;
+
+	spec.usingDelim = true;
+	spec.delimiters.push_back("");
+	size_t i = 0;
+	for (; i < size; ++i) {
+		if (numbers[i] == '[') continue;
+		if (numbers[i] == ']') {
+			if ((i + 1) < size && numbers[i + 1] != '[') {
+				++i;
+				break;
+			}
+			spec.delimiters.push_back("");
+			continue;
+		}
+		spec.delimiters[spec.delimiters.size() - 1] += numbers[i];
+	}
+	spec.bodyStart = i;
+	return spec;
+}
+
+DelimSpec ParseDelimSpec(const std::string& numbers) {
+	return ParseDelimSpec(numbers.data(), numbers.size());
+}
+
+int ParseTokenValue(const char* first, const char* last) {	//same result as reading an int from a stringstream, without the copy
+	while (first != last && (*first == ' ' || (*first >= '\t' && *first <= '\r'))) ++first;	//stringstream skips leading whitespace
+	bool negative = false;
+	if (first != last && (*first == '-' || *first == '+')) negative = *first++ == '-';
+	long long value = 0;
+	for (; first != last && *first >= '0' && *first <= '9'; ++first) {
+		value = value * 10 + (*first - '0');
+		if (value > 1LL + INT_MAX) value = 1LL + INT_MAX;	//out of range, stringstream gives back INT_MAX or INT_MIN
+	}
+	if (negative) return value > INT_MAX ? INT_MIN : int(-value);
+	return value > INT_MAX ? INT_MAX : int(value);
+}
+
+void PutUint32(std::string& out, uint32_t value) {	//little endian whatever the machine is
+	for (int i = 0; i < 4; ++i) out += char((value >> (8 * i)) & 0xFF);
+}
+
+uint32_t GetUint32(const char* in) {
+	uint32_t value = 0;
+	for (int i = 0; i < 4; ++i) value |= uint32_t(uint8_t(in[i])) << (8 * i);
+	return value;
+}
+
+class MappedFile {	//read only view of a whole file
+public:
+	explicit MappedFile(const std::string& path) {
+#ifdef _WIN32
+		file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+		if (file == INVALID_HANDLE_VALUE) throw std::runtime_error("can't open " + path);
+		LARGE_INTEGER length;
+		GetFileSizeEx(file, &length);
+		size = size_t(length.QuadPart);
+		if (size) {
+			mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+			if (mapping) data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+			if (!data) {
+				Close();
+				throw std::runtime_error("can't map " + path);
+			}
+		}
+#else
+		descriptor = open(path.c_str(), O_RDONLY);
+		if (descriptor < 0) throw std::runtime_error("can't open " + path);
+		struct stat info;
+		fstat(descriptor, &info);
+		size = size_t(info.st_size);
+		if (size) {
+			void* view = mmap(nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0);
+			if (view == MAP_FAILED) {
+				Close();
+				throw std::runtime_error("can't map " + path);
+			}
+			data = static_cast<const char*>(view);
+		}
+#endif
+	}
+
+	~MappedFile() { Close(); }
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	const char* Data() const { return data ? data : ""; }
+	size_t Size() const { return size; }
+
+private:
+	void Close() {
+#ifdef _WIN32
+		if (data) UnmapViewOfFile(data);
+		if (mapping) CloseHandle(mapping);
+		if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+		mapping = NULL;
+		file = INVALID_HANDLE_VALUE;
+#else
+		if (data) munmap(const_cast<char*>(data), size);
+		if (descriptor >= 0) close(descriptor);
+		descriptor = -1;
+#endif
+		data = nullptr;
+	}
+
+	const char* data = nullptr;
+	size_t size = 0;
+#ifdef _WIN32
+	HANDLE file = INVALID_HANDLE_VALUE;
+	HANDLE mapping = NULL;
+#else
+	int descriptor = -1;
+#endif
+};
+
+void PutUint64(std::string& out, uint64_t value) {
+	PutUint32(out, uint32_t(value));
+	PutUint32(out, uint32_t(value >> 32));
+}
+
+uint64_t GetUint64(const char* in) {
+	return GetUint32(in) | uint64_t(GetUint32(in + 4)) << 32;
+}
+
+uint64_t SpecHash(const char* data, size_t size) {	//FNV-1a
+	uint64_t hash = 14695981039346656037ULL;
+	for (size_t i = 0; i < size; ++i) hash = (hash ^ uint8_t(data[i])) * 1099511628211ULL;
+	return hash;
+}
+
+size_t HeaderEnd(const char* data, size_t size) {	//where Add() stops reading delimiters, 0 without any and size if they never end
+	if (size == 0 || isdigit(data[0])) return 0;
+	for (const char* close = data; (close = static_cast<const char*>(std::memchr(close, ']', data + size - close))); ++close) {
+		if (close + 1 < data + size && close[1] != '[') return close + 1 - data;
+	}
+	return size;
+}
+
+//A record is headerSize, delimCount, a 256 bit set of first bytes, an (offset, length) pair for each delimiter, then the header and
+//delimiter bytes. Offsets are from the start of the record and everything is little endian, so a record can be used where it is mapped
+const uint32_t SpecVersion = 1;
+const size_t RecordFixedSize = 8 + 32;
+const size_t StoreHeaderSize = 40;	//magic, version, slot count, spec count, reserved, file size, checksum
+const size_t SlotSize = 16;	//hash, record offset (0 when empty), header size
+
+std::string CompileSpec(const char* header, size_t size) {	//header is what HeaderEnd() gives, the same delimiters as ParseDelimSpec()
+	DelimSpec spec = ParseDelimSpec(header, size);
+	std::vector<const std::string*> delims;
+	for (const std::string& delim : spec.delimiters) {
+		if (delim.size()) delims.push_back(&delim);	//an empty one never matches
+	}
+	std::string record;
+	PutUint32(record, uint32_t(size));
+	PutUint32(record, uint32_t(delims.size()));
+	uint8_t firstBytes[32] = {};
+	for (const std::string* delim : delims) firstBytes[uint8_t(delim->front()) / 8] |= 1 << (uint8_t(delim->front()) % 8);
+	record.append(reinterpret_cast<const char*>(firstBytes), 32);
+	size_t offset = RecordFixedSize + 8 * delims.size() + size;
+	for (const std::string* delim : delims) {
+		PutUint32(record, uint32_t(offset));
+		PutUint32(record, uint32_t(delim->size()));
+		offset += delim->size();
+	}
+	record.append(header, size);
+	for (const std::string* delim : delims) record += *delim;
+	return record;
+}
+
+class CompiledSpec {	//a view of a record, in a mapped store or in a SpecCache
+public:
+	CompiledSpec() = default;
+	explicit CompiledSpec(const char* record) :record(record) {}
+
+	bool UsingDelim() const { return record != nullptr; }	//without a record any non digit splits numbers
+	size_t HeaderSize() const { return record ? GetUint32(record) : 0; }
+	size_t DelimCount() const { return record ? GetUint32(record + 4) : 0; }
+	std::string Header() const { return std::string(record + RecordFixedSize + 8 * DelimCount(), HeaderSize()); }
+	std::string Delim(size_t d) const { return std::string(record + GetUint32(DelimEntry(d)), GetUint32(DelimEntry(d) + 4)); }
+
+	size_t Match(const char* data, size_t size, size_t i) const {	//length of the delimiter at i, 0 if there is none
+		uint8_t c = uint8_t(data[i]);
+		if (!record) return isdigit(c) ? 0 : 1;
+		if (!(record[8 + c / 8] & (1 << (c % 8)))) return 0;	//most bytes start no delimiter
+		for (size_t d = 0, count = DelimCount(); d < count; ++d) {
+			const char* entry = DelimEntry(d);
+			size_t length = GetUint32(entry + 4);
+			if (size - i >= length && std::memcmp(data + i, record + GetUint32(entry), length) == 0) return length;
+		}
+		return 0;
+	}
+
+private:
+	const char* DelimEntry(size_t d) const { return record + RecordFixedSize + 8 * d; }
+
+	const char* record = nullptr;
+};
+
+void SaveSpecStore(const std::string& path, const std::vector<std::string>& headers) {	//headers as HeaderEnd() gives them, repeats are dropped
+	std::vector<std::string> unique;
+	std::unordered_map<std::string, bool> seen;
+	for (const std::string& header : headers) {
+		if (header.size() && !seen[header]) {
+			seen[header] = true;
+			unique.push_back(header);
+		}
+	}
+	size_t slots = 8;
+	while (slots < 2 * unique.size()) slots *= 2;	//at most half full so probes stay short
+
+	std::string table(slots * SlotSize, '\0'), records;
+	size_t recordsStart = StoreHeaderSize + table.size();
+	for (const std::string& header : unique) {
+		uint64_t hash = SpecHash(header.data(), header.size());
+		size_t slot = size_t(hash) & (slots - 1);
+		while (GetUint32(&table[slot * SlotSize + 8])) slot = (slot + 1) & (slots - 1);
+		while (records.size() % 8) records += '\0';	//records start 8 byte aligned
+		std::string entry;
+		PutUint64(entry, hash);
+		PutUint32(entry, uint32_t(recordsStart + records.size()));
+		PutUint32(entry, uint32_t(header.size()));
+		table.replace(slot * SlotSize, SlotSize, entry);
+		records += CompileSpec(header.data(), header.size());
+	}
+	if (recordsStart + records.size() > UINT32_MAX) throw std::length_error("too many headers for one spec store");
+
+	std::string body = table + records, out = "TDDSPECS";
+	PutUint32(out, SpecVersion);
+	PutUint32(out, uint32_t(slots));
+	PutUint32(out, uint32_t(unique.size()));
+	PutUint32(out, 0);
+	PutUint64(out, StoreHeaderSize + body.size());
+	PutUint64(out, SpecHash(body.data(), body.size()));
+	out += body;
+
+	std::string temporary = path + ".tmp";	//readers see the old store or the new one, never half of one
+	FILE* file = std::fopen(temporary.c_str(), "wb");
+	if (!file) throw std::runtime_error("can't write " + temporary);
+	bool written = std::fwrite(out.data(), 1, out.size(), file) == out.size() && std::fflush(file) == 0;
+#ifndef _WIN32
+	written = written && fsync(fileno(file)) == 0;
+#endif
+	written = std::fclose(file) == 0 && written;
+#ifdef _WIN32
+	if (written) std::remove(path.c_str());	//rename won't replace a file on windows
+#endif
+	if (!written || std::rename(temporary.c_str(), path.c_str()) != 0) {
+		std::remove(temporary.c_str());
+		throw std::runtime_error("can't write " + path);
+	}
+}
+
+class SpecStore {	//a saved store mapped read only, many processes can share the pages
+public:
+	explicit SpecStore(const std::string& path) :file(path) {
+		const char* data = file.Data();
+		size_t size = file.Size();
+		if (size < StoreHeaderSize || std::memcmp(data, "TDDSPECS", 8) != 0) throw std::runtime_error(path + " is not a spec store");
+		if (GetUint32(data + 8) != SpecVersion) throw std::runtime_error(path + " is from another version");
+		slots = GetUint32(data + 12);
+		count = GetUint32(data + 16);
+		if (GetUint64(data + 24) != size || slots == 0 || (slots & (slots - 1)) || slots > (size - StoreHeaderSize) / SlotSize
+			|| GetUint64(data + 32) != SpecHash(data + StoreHeaderSize, size - StoreHeaderSize)) throw std::runtime_error(path + " is damaged");
+
+		size_t filled = 0;	//the checksum only shows the file is what was written, check it can be used too
+		for (size_t slot = 0; slot < slots; ++slot) {
+			const char* entry = Slot(slot);
+			size_t offset = GetUint32(entry + 8);
+			if (offset == 0) continue;
+			++filled;
+			if (offset < StoreHeaderSize + slots * SlotSize || offset % 8 || size - offset < RecordFixedSize || !RecordFits(data + offset, size - offset)) throw std::runtime_error(path + " is damaged");
+			CompiledSpec spec(data + offset);
+			std::string header = spec.Header();
+			if (spec.HeaderSize() != GetUint32(entry + 12) || GetUint64(entry) != SpecHash(header.data(), header.size())
+				|| isdigit(header.front()) || header.back() != ']' || HeaderEnd(header.data(), header.size()) != header.size()) throw std::runtime_error(path + " is damaged");
+		}
+		if (filled != count || filled == slots) throw std::runtime_error(path + " is damaged");	//a full table would never stop probing
+	}
+
+	bool Find(const char* header, size_t size, CompiledSpec& spec) const {	//header as HeaderEnd() gives it
+		uint64_t hash = SpecHash(header, size);
+		for (size_t slot = size_t(hash) & (slots - 1);; slot = (slot + 1) & (slots - 1)) {
+			const char* entry = Slot(slot);
+			size_t offset = GetUint32(entry + 8);
+			if (offset == 0) return false;
+			if (GetUint64(entry) != hash || GetUint32(entry + 12) != size) continue;
+			const char* record = file.Data() + offset;
+			if (std::memcmp(record + RecordFixedSize + 8 * GetUint32(record + 4), header, size) == 0) {	//the whole header, not just the hash
+				spec = CompiledSpec(record);
+				return true;
+			}
+		}
+	}
+
+	std::vector<std::string> Headers() const {
+		std::vector<std::string> headers;
+		for (size_t slot = 0; slot < slots; ++slot) {
+			if (size_t offset = GetUint32(Slot(slot) + 8)) headers.push_back(CompiledSpec(file.Data() + offset).Header());
+		}
+		return headers;
+	}
+
+	size_t Size() const { return count; }
+
+private:
+	const char* Slot(size_t slot) const { return file.Data() + StoreHeaderSize + slot * SlotSize; }
+
+	static bool RecordFits(const char* record, size_t room) {
+		uint64_t headerSize = GetUint32(record), delimCount = GetUint32(record + 4);
+		uint64_t end = RecordFixedSize + 8 * delimCount + headerSize;
+		if (headerSize == 0 || end > room) return false;
+		for (uint64_t d = 0; d < delimCount; ++d) {	//delimiters come after the header, in order and not empty
+			uint64_t offset = GetUint32(record + RecordFixedSize + 8 * d), length = GetUint32(record + RecordFixedSize + 8 * d + 4);
+			if (offset != end || length == 0 || length > room - end) return false;
+			end += length;
+		}
+		return true;
+	}
+
+	MappedFile file;
+	size_t slots = 0;
+	size_t count = 0;
+};
+
+class SpecCache {	//the store first, then headers compiled since it was loaded
+public:
+	explicit SpecCache(const SpecStore* store = nullptr) :store(store) {}
+
+	CompiledSpec Get(const char* header, size_t size) {
+		CompiledSpec spec;
+		if (size == 0) return spec;
+		if (store && store->Find(header, size, spec)) {
+			++hits;
+			return spec;
+		}
+		std::string& record = compiled[std::string(header, size)];	//unordered_map never moves its values, so the view stays valid
+		if (record.empty()) {
+			record = CompileSpec(header, size);
+			++misses;
+		}
+		return CompiledSpec(record.data());
+	}
+
+	std::vector<std::string> Headers() const {	//everything known, to save for the next start
+		std::vector<std::string> headers;
+		if (store) headers = store->Headers();
+		for (const auto& entry : compiled) headers.push_back(entry.first);
+		return headers;
+	}
+
+	size_t Hits() const { return hits; }
+	size_t Misses() const { return misses; }	//headers that had to be compiled
+
+private:
+	const SpecStore* store;
+	std::unordered_map<std::string, std::string> compiled;
+	size_t hits = 0;
+	size_t misses = 0;
+};
+
+int AddCompiled(SpecCache& cache, const std::string& numbers) {	//same result as Add()
+	const char* data = numbers.data();
+	size_t size = numbers.size(), start = HeaderEnd(data, size);
+	if (start == size && size) return 0;	//the delimiters never end, so there are no numbers
+	CompiledSpec spec = cache.Get(data, start);
+	auto value = [](const char* first, const char* last) {
+		int number = ParseTokenValue(first, last);
+		if (number < 0) throw NegativeNumberException(number);
+		return number <= 1000 ? number : 0;
+	};
+	int sum = 0;
+	for (size_t i = start; i < size;) {
+		size_t length = spec.Match(data, size, i);
+		if (length == 0) {
+			++i;
+			continue;
+		}
+		sum += value(data + start, data + i);
+		i += length;
+		start = i;
+	}
+	return sum + value(data + start, data + size);
+}
+
+int main()
+{
+	try{
+
+		std::cout << "Accepts the following syntax:\n**\nstring-of-numbers\n**\n[delimiter]\n[more delimiters...]\nstring-of-numbers\n**\n";
+		SpecCache first;	//a process with no store compiles every header it meets
+		std::string inputs[] = { "[;]1;2", "[***][%]1***2%3", "[;]4;5", "1,2" };
+		for (const std::string& input : inputs) std::cout << AddCompiled(first, input) << ' ';
+		std::cout << first.Misses() << '\n';
+		SaveSpecStore("specs.store", first.Headers());
+
+		SpecStore store("specs.store");	//the next one starts with them
+		SpecCache next(&store);
+		for (const std::string& input : inputs) std::cout << AddCompiled(next, input) << ' ';
+		std::cout << store.Size() << ' ' << next.Hits() << ' ' << next.Misses() << '\n';
+		std::remove("specs.store");
+
+		//Expected output:
+		//3 6 9 3 2
+		//3 6 9 3 2 3 0
+	}
+	catch (std::exception& e) {
+		std::cerr << "Exception: " << e.what() << '\n';
+	}
+	system("pause");	//prevent cmd window from closing on windows
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,356 @@
+#define BOOST_TEST_MODULE AddStringTest
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include "boost\test\unit_test.hpp"
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//10.
+//Parse the string once and keep the numbers in a compact column so repeated sums, counts and range queries don't re-read the text.
+//Accepted values are 0 to 1000, so every number fits in 16 bits. Negatives and numbers over 1000 are flagged when parsing
+// - Added ForEachToken(), the scan from Add() with a callback instead of the converted vector, and ParseNumber() without the Step 5 and 6 checks
+//	 Added ParsedNumbers and ParseNumbers(). Values are a uint16 column with optional byte offsets and a flags column
+//	 Sums and counts over the column use SSE2 when it is available
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TDD_SSE2
+#include <emmintrin.h>
+#endif
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+template <typename T>
+T ParseNumber(const std::string& s) {	//StringToNumber() without the negative and over 1000 checks
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	return result;
+}
+
+size_t MatchDelim(const std::vector<std::string>& delimiters, const std::string& numbers, size_t i) {	//length of the first delim found at i, 0 if there isn't one
+	for (const std::string& delim : delimiters) {
+		if (delim.empty() || numbers[i] != delim.front()) continue;
+		if (numbers.compare(i, delim.size(), delim) == 0) return delim.size();
+	}
+	return 0;
+}
+
+//Same walk over the string as Add(), but every non empty number substring is handed to onToken(substring, offset)
+template <typename F>
+void ForEachToken(const std::string& numbers, F onToken) {
+	std::string substring = "";
+	size_t start = 0;	//offset of the first character in substring
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (size_t i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;
+			if (numbers[i] == ']') {
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;
+				else delimiters.push_back("");
+				continue;
+			}
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+
+		size_t delimLength = 0;
+		if (isdigit(numbers[i]) && !usingDelim) delimLength = 0;
+		else if (usingDelim) delimLength = MatchDelim(delimiters, numbers, i);
+		else delimLength = 1;	//any non digit splits numbers when the user didn't supply a delim
+
+		if (delimLength) {
+			if (substring != "") {
+				onToken(substring, start);
+				substring = "";
+			}
+			i += delimLength - 1;
+		}
+		else {
+			if (substring == "") start = i;
+			substring += numbers[i];
+		}
+	}
+	if (substring != "") onToken(substring, start);
+}
+
+enum TokenFlags : uint8_t {
+	TokenNegative = 1,
+	TokenCapped = 2	//over 1000, ignored by Add()
+};
+
+size_t SumColumn(const uint16_t* values, size_t count, long long& sum) {	//adds count values to sum, returns count for chaining
+#ifdef TDD_SSE2
+	const __m128i ones = _mm_set1_epi16(1);
+	size_t i = 0;
+	while (i + 8 <= count) {
+		__m128i total = _mm_setzero_si128();
+		size_t blockEnd = std::min(count & ~size_t(7), i + 8 * 65536);	//each 32 bit lane gains at most 2000 per step, flush before it can overflow
+		for (; i < blockEnd; i += 8) {
+			__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+			total = _mm_add_epi32(total, _mm_madd_epi16(v, ones));	//values are at most 1000 so the signed multiply is safe
+		}
+		int32_t lanes[4];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), total);
+		sum += (long long)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+	}
+	for (; i < count; ++i) sum += values[i];
+#else
+	for (size_t i = 0; i < count; ++i) sum += values[i];
+#endif
+	return count;
+}
+
+size_t CountColumn(const uint16_t* values, size_t count, uint16_t low, uint16_t high) {	//how many values are in [low, high]
+	size_t found = 0;
+	size_t i = 0;
+#ifdef TDD_SSE2
+	const __m128i below = _mm_set1_epi16(short(low) - 1);
+	const __m128i above = _mm_set1_epi16(short(std::min<uint16_t>(high, 32766)) + 1);
+	for (; i + 8 <= count; i += 8) {
+		__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+		__m128i inside = _mm_and_si128(_mm_cmpgt_epi16(v, below), _mm_cmplt_epi16(v, above));
+		for (int mask = _mm_movemask_epi8(inside); mask; mask &= mask - 1) ++found;	//two mask bits per 16 bit lane
+	}
+	found /= 2;
+#endif
+	for (; i < count; ++i) if (values[i] >= low && values[i] <= high) ++found;
+	return found;
+}
+
+struct ParsedNumbers {
+	std::vector<uint16_t> values;	//accepted value of every number, negatives and numbers over 1000 are stored as 0
+	std::vector<uint8_t> flags;	//TokenFlags for every number
+	std::vector<uint32_t> offsets;	//byte offset of every number, empty unless ParseNumbers() was asked for them
+	std::vector<int> negatives;	//every negative in the order they appear
+	size_t cappedCount = 0;
+
+	size_t Count() const { return values.size(); }
+	size_t AcceptedCount() const { return values.size() - negatives.size() - cappedCount; }
+
+	long long Sum() const {	//same result as Add(), including the exception
+		return SumRange(0, values.size());
+	}
+
+	long long SumRange(size_t first, size_t last) const {	//sum of the numbers with index [first, last)
+		if (last > values.size()) last = values.size();
+		if (first >= last) return 0;
+		if (negatives.size()) {
+			size_t before = 0;
+			for (size_t i = 0; i < first; ++i) if (flags[i] & TokenNegative) ++before;
+			for (size_t i = first; i < last; ++i) if (flags[i] & TokenNegative) throw NegativeNumberException(negatives[before]);
+		}
+		long long sum = 0;
+		SumColumn(values.data() + first, last - first, sum);
+		return sum;
+	}
+
+	size_t CountInRange(uint16_t low, uint16_t high) const {	//how many accepted numbers have a value in [low, high]
+		size_t found = CountColumn(values.data(), values.size(), low, high);
+		if (low == 0) found -= negatives.size() + cappedCount;	//flagged numbers are stored as 0 but weren't accepted
+		return found;
+	}
+};
+
+ParsedNumbers ParseNumbers(const std::string& numbers, bool withOffsets = false) {
+	if (withOffsets && numbers.size() > std::numeric_limits<uint32_t>::max()) throw std::length_error("offsets only cover the first 4GB");
+
+	ParsedNumbers parsed;
+	ForEachToken(numbers, [&](const std::string& substring, size_t offset) {
+		int value = ParseNumber<int>(substring);
+		uint8_t flags = 0;
+		if (value < 0) {
+			flags = TokenNegative;
+			parsed.negatives.push_back(value);
+			value = 0;
+		}
+		else if (value > 1000) {
+			flags = TokenCapped;
+			++parsed.cappedCount;
+			value = 0;
+		}
+		parsed.values.push_back(uint16_t(value));
+		parsed.flags.push_back(flags);
+		if (withOffsets) parsed.offsets.push_back(uint32_t(offset));
+	});
+	return parsed;
+}
+
+BOOST_AUTO_TEST_CASE(test10) {
+	const char* inputs[] = { "1 2 3", "[,,][..]1..2,,3", "[\nn][...]1\nn1001|\nn1\n1 ,.(\nn1...1\n", "[;]23;/4;;7", "[;]", "" };
+	for (const char* input : inputs) BOOST_CHECK(ParseNumbers(input).Sum() == Add(input));
+	BOOST_CHECK_THROW(ParseNumbers("[\n]3\n9\n-1").Sum(), NegativeNumberException);
+
+	ParsedNumbers parsed = ParseNumbers("[;]5;-2;1500;7", true);
+	BOOST_CHECK(parsed.Count() == 4);
+	BOOST_CHECK(parsed.AcceptedCount() == 2);
+	BOOST_CHECK(parsed.negatives.size() == 1 && parsed.negatives[0] == -2);
+	BOOST_CHECK(parsed.flags[1] == TokenNegative);
+	BOOST_CHECK(parsed.flags[2] == TokenCapped);
+	BOOST_CHECK(parsed.offsets[0] == 3 && parsed.offsets[3] == 13);
+	BOOST_CHECK(parsed.SumRange(2, 4) == 7);
+	BOOST_CHECK_THROW(parsed.SumRange(0, 2), NegativeNumberException);
+	BOOST_CHECK(parsed.CountInRange(0, 1000) == 2);
+}
+
+BOOST_AUTO_TEST_CASE(test10_column) {
+	std::string numbers;
+	int expected = 0;
+	size_t between = 0;
+	for (int i = 0; i < 5000; ++i) {
+		int value = (i * 7919) % 1200;
+		numbers += std::to_string(value) + ",";
+		if (value <= 1000) expected += value;
+		if (value >= 100 && value <= 200) ++between;
+	}
+	ParsedNumbers parsed = ParseNumbers(numbers);
+	BOOST_CHECK(parsed.Sum() == expected);
+	BOOST_CHECK(parsed.Sum() == Add(numbers));
+	BOOST_CHECK(parsed.CountInRange(100, 200) == between);
+}
\ No newline at end of file
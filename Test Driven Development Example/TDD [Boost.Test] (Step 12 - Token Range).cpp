@@ -0,0 +1,344 @@
+#define BOOST_TEST_MODULE AddStringTest
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include "boost\test\unit_test.hpp"
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//12.
+//Read the numbers lazily instead of converting all of them into a vector first. tokens(input, spec) should give back each
+//number (and where it starts) as it is needed, work with the standard algorithms and let the caller stop early without reading the rest
+// - Added DelimSpec and ParseDelimSpec(), the delimiter reading from the top of Add() on its own
+//	 Added ParseTokenValue(), which converts a substring the same way as the stringstream in StringToNumber() but without copying it
+//	 Added TokenIterator and TokenRange. Nothing is allocated while iterating, and with C++20 TokenRange is a std::ranges view
+//	 Added Sum(), which follows the Step 5 and 6 rules and stops at the first negative
+
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+#define TDD_RANGES
+#include <ranges>
+#endif
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+struct DelimSpec {
+	bool usingDelim = false;	//false means any non digit splits numbers
+	std::vector<std::string> delimiters;
+	size_t bodyStart = 0;	//offset of the first character after the delimiter declarations
+};
+
+DelimSpec ParseDelimSpec(const char* numbers, size_t size) {	//reads the delimiters the same way as the top of Add()
+	DelimSpec spec;
+	if (size == 0 || isdigit(numbers[0])) return spec;
+
+	spec.usingDelim = true;
+	spec.delimiters.push_back("");
+	size_t i = 0;
+	for (; i < size; ++i) {
+		if (numbers[i] == '[') continue;
+		if (numbers[i] == ']') {
+			if ((i + 1) < size && numbers[i + 1] != '[') {
+				++i;
+				break;
+			}
+			spec.delimiters.push_back("");
+			continue;
+		}
+		spec.delimiters[spec.delimiters.size() - 1] += numbers[i];
+	}
+	spec.bodyStart = i;
+	return spec;
+}
+
+DelimSpec ParseDelimSpec(const std::string& numbers) {
+	return ParseDelimSpec(numbers.data(), numbers.size());
+}
+
+int ParseTokenValue(const char* first, const char* last) {	//same result as reading an int from a stringstream, without the copy
+	while (first != last && (*first == ' ' || (*first >= '\t' && *first <= '\r'))) ++first;	//stringstream skips leading whitespace
+	bool negative = false;
+	if (first != last && (*first == '-' || *first == '+')) negative = *first++ == '-';
+	long long value = 0;
+	for (; first != last && *first >= '0' && *first <= '9'; ++first) {
+		value = value * 10 + (*first - '0');
+		if (value > 1LL + INT_MAX) value = 1LL + INT_MAX;	//out of range, stringstream gives back INT_MAX or INT_MIN
+	}
+	if (negative) return value > INT_MAX ? INT_MIN : int(-value);
+	return value > INT_MAX ? INT_MAX : int(value);
+}
+
+struct Token {
+	int value;	//converted without the Step 5 and 6 rules, so negatives and numbers over 1000 come through as they are
+	size_t offset;
+	size_t length;
+};
+
+class TokenIterator {
+public:
+	using iterator_category = std::input_iterator_tag;
+	using iterator_concept = std::forward_iterator_tag;
+	using value_type = Token;
+	using difference_type = std::ptrdiff_t;
+	using pointer = void;
+	using reference = Token;
+
+	TokenIterator() = default;
+	TokenIterator(const char* data, size_t size, const DelimSpec* spec) :data(data), size(size), spec(spec), position(spec->bodyStart), atEnd(false) {
+		Next();
+	}
+
+	Token operator*() const { return current; }
+	TokenIterator& operator++() { Next(); return *this; }
+	TokenIterator operator++(int) { TokenIterator before = *this; Next(); return before; }
+
+	bool operator==(const TokenIterator& other) const {
+		return atEnd == other.atEnd && (atEnd || current.offset == other.current.offset);
+	}
+	bool operator!=(const TokenIterator& other) const { return !(*this == other); }
+
+private:
+	size_t DelimAt(size_t i) const {	//length of the delimiter found at i, 0 if i is part of a number
+		if (!spec->usingDelim) return (data[i] >= '0' && data[i] <= '9') ? 0 : 1;
+		for (const std::string& delim : spec->delimiters) {
+			if (delim.empty() || data[i] != delim.front() || size - i < delim.size()) continue;
+			if (std::memcmp(data + i, delim.data(), delim.size()) == 0) return delim.size();
+		}
+		return 0;
+	}
+
+	void Next() {
+		size_t length;
+		while (position < size && (length = DelimAt(position)) != 0) position += length;	//skip delimiters until a number starts
+		if (position >= size) {
+			atEnd = true;
+			return;
+		}
+		size_t start = position;
+		while (position < size && DelimAt(position) == 0) ++position;
+		current.offset = start;
+		current.length = position - start;
+		current.value = ParseTokenValue(data + start, data + position);
+	}
+
+	const char* data = nullptr;
+	size_t size = 0;
+	const DelimSpec* spec = nullptr;
+	size_t position = 0;
+	Token current = Token();
+	bool atEnd = true;	//a default constructed iterator is an end iterator
+};
+
+class TokenRange
+#ifdef TDD_RANGES
+	: public std::ranges::view_base
+#endif
+{
+public:
+	TokenRange() = default;
+	TokenRange(const char* data, size_t size, const DelimSpec& spec) :data(data), size(size), spec(&spec) {}
+
+	TokenIterator begin() const { return spec ? TokenIterator(data, size, spec) : TokenIterator(); }
+	TokenIterator end() const { return TokenIterator(); }
+
+private:
+	const char* data = nullptr;
+	size_t size = 0;
+	const DelimSpec* spec = nullptr;
+};
+
+//The range points into input and spec, both have to outlive it
+TokenRange tokens(const char* data, size_t size, const DelimSpec& spec) {
+	return TokenRange(data, size, spec);
+}
+
+TokenRange tokens(const std::string& input, const DelimSpec& spec) {
+	return TokenRange(input.data(), input.size(), spec);
+}
+
+long long Sum(const TokenRange& range) {	//same result as Add(), stops reading at the first negative
+	long long result = 0;
+	for (Token token : range) {
+		if (token.value < 0) throw NegativeNumberException(token.value);
+		if (token.value <= 1000) result += token.value;
+	}
+	return result;
+}
+
+BOOST_AUTO_TEST_CASE(test12) {
+	const char* inputs[] = { "1 2 3", "[,,][..]1..2,,3", "[\nn][...]1\nn1001|\nn1\n1 ,.(\nn1...1\n", "[;]23;/4;;7", "[;]", "", "[a][aa]1aaa2", "[;] 12 ;+3;99999999999" };
+	for (const char* input : inputs) {
+		std::string numbers = input;
+		DelimSpec spec = ParseDelimSpec(numbers);
+		BOOST_CHECK(Sum(tokens(numbers, spec)) == Add(numbers));
+	}
+	std::string negatives = "[\n]3\n9\n-1";
+	DelimSpec spec = ParseDelimSpec(negatives);
+	BOOST_CHECK_THROW(Sum(tokens(negatives, spec)), NegativeNumberException);
+	BOOST_CHECK(ParseTokenValue("-0", "-0" + 2) == 0);
+	BOOST_CHECK(ParseTokenValue("-99999999999", "-99999999999" + 12) == INT_MIN);
+}
+
+BOOST_AUTO_TEST_CASE(test12_early_exit) {
+	std::string numbers = "[;]1;-2;3;-4";
+	DelimSpec spec = ParseDelimSpec(numbers);
+	BOOST_CHECK(spec.bodyStart == 3);
+
+	TokenRange range = tokens(numbers, spec);
+	TokenIterator it = range.begin();
+	BOOST_CHECK((*it).value == 1 && (*it).offset == 3 && (*it).length == 1);
+	TokenIterator negative = std::find_if(range.begin(), range.end(), [](Token token) { return token.value < 0; });
+	BOOST_CHECK((*negative).value == -2 && (*negative).offset == 5);
+	BOOST_CHECK(std::distance(range.begin(), range.end()) == 4);
+	BOOST_CHECK(TokenRange().begin() == TokenRange().end());
+}
+
+#ifdef TDD_RANGES
+BOOST_AUTO_TEST_CASE(test12_ranges) {
+	static_assert(std::ranges::forward_range<TokenRange>, "TokenRange should be a forward range");
+	static_assert(std::ranges::view<TokenRange>, "TokenRange should be a view");
+
+	std::string numbers = "[;]5;6;700;8;9";
+	DelimSpec spec = ParseDelimSpec(numbers);
+	int below = 0;
+	for (int value : tokens(numbers, spec) | std::views::transform([](Token token) { return token.value; }) | std::views::take_while([](int value) { return value < 100; })) below += value;
+	BOOST_CHECK(below == 11);
+	BOOST_CHECK(std::ranges::count_if(tokens(numbers, spec), [](Token token) { return token.value > 6; }) == 3);
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,580 @@
+#define BOOST_TEST_MODULE AddStringTest
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "boost\test\unit_test.hpp"
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//14.
+//Answer "what is the sum of the numbers that start between byte X and byte Y" for a large file without reading all of it.
+//Read the file once to build an index file with the running sum, the scan state and the negative count at every chunk boundary.
+//A query then only reads the file around X and Y
+// - Added DelimSpec, ParseDelimSpec() and ParseTokenValue() from Step 12 and HashBytes() from Step 9
+//	 Added MappedFile, which maps a file into memory on windows and posix
+//	 Added ChunkIndex. Build() writes the index next to the file, RangeSum() reads it and rescans at most two partial chunks
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+struct DelimSpec {
+	bool usingDelim = false;	//false means any non digit splits numbers
+	std::vector<std::string> delimiters;
+	size_t bodyStart = 0;	//offset of the first character after the delimiter declarations
+};
+
+DelimSpec ParseDelimSpec(const char* numbers, size_t size) {	//reads the delimiters the same way as the top of Add()
+	DelimSpec spec;
+	if (size == 0 || isdigit(numbers[0])) return spec;
+
+	spec.usingDelim = true;
+	spec.delimiters.push_back("");
+	size_t i = 0;
+	for (; i < size; ++i) {
+		if (numbers[i] == '[') continue;
+		if (numbers[i] == ']') {
+			if ((i + 1) < size && numbers[i + 1] != '[') {
+				++i;
+				break;
+			}
+			spec.delimiters.push_back("");
+			continue;
+		}
+		spec.delimiters[spec.delimiters.size() - 1] += numbers[i];
+	}
+	spec.bodyStart = i;
+	return spec;
+}
+
+DelimSpec ParseDelimSpec(const std::string& numbers) {
+	return ParseDelimSpec(numbers.data(), numbers.size());
+}
+
+int ParseTokenValue(const char* first, const char* last) {	//same result as reading an int from a stringstream, without the copy
+	while (first != last && (*first == ' ' || (*first >= '\t' && *first <= '\r'))) ++first;	//stringstream skips leading whitespace
+	bool negative = false;
+	if (first != last && (*first == '-' || *first == '+')) negative = *first++ == '-';
+	long long value = 0;
+	for (; first != last && *first >= '0' && *first <= '9'; ++first) {
+		value = value * 10 + (*first - '0');
+		if (value > 1LL + INT_MAX) value = 1LL + INT_MAX;	//out of range, stringstream gives back INT_MAX or INT_MIN
+	}
+	if (negative) return value > INT_MAX ? INT_MIN : int(-value);
+	return value > INT_MAX ? INT_MAX : int(value);
+}
+
+uint64_t HashBytes(const char* data, size_t size) {	//reads 8 bytes at a time, the tail is zero padded
+	const uint64_t k0 = 0x9E3779B97F4A7C15ULL, k1 = 0xC2B2AE3D27D4EB4FULL;
+	uint64_t h = k0 ^ (size * k1);
+	uint64_t word = 0;
+	size_t i = 0;
+	for (; i + 8 <= size; i += 8) {
+		std::memcpy(&word, data + i, 8);
+		h = (h ^ (word * k1)) * k0;
+		h ^= h >> 29;
+	}
+	word = 0;
+	std::memcpy(&word, data + i, size - i);
+	h = (h ^ (word * k1)) * k0;
+	h ^= h >> 32;	//final mix so the low bits depend on every input byte
+	h *= k1;
+	h ^= h >> 29;
+	return h;
+}
+
+class MappedFile {	//read only view of a whole file
+public:
+	explicit MappedFile(const std::string& path) {
+#ifdef _WIN32
+		file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+		if (file == INVALID_HANDLE_VALUE) throw std::runtime_error("can't open " + path);
+		LARGE_INTEGER length;
+		GetFileSizeEx(file, &length);
+		size = size_t(length.QuadPart);
+		if (size) {
+			mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+			if (mapping) data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+			if (!data) {
+				Close();
+				throw std::runtime_error("can't map " + path);
+			}
+		}
+#else
+		descriptor = open(path.c_str(), O_RDONLY);
+		if (descriptor < 0) throw std::runtime_error("can't open " + path);
+		struct stat info;
+		fstat(descriptor, &info);
+		size = size_t(info.st_size);
+		if (size) {
+			void* view = mmap(nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0);
+			if (view == MAP_FAILED) {
+				Close();
+				throw std::runtime_error("can't map " + path);
+			}
+			data = static_cast<const char*>(view);
+		}
+#endif
+	}
+
+	~MappedFile() { Close(); }
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	const char* Data() const { return data ? data : ""; }
+	size_t Size() const { return size; }
+
+private:
+	void Close() {
+#ifdef _WIN32
+		if (data) UnmapViewOfFile(data);
+		if (mapping) CloseHandle(mapping);
+		if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+		mapping = NULL;
+		file = INVALID_HANDLE_VALUE;
+#else
+		if (data) munmap(const_cast<char*>(data), size);
+		if (descriptor >= 0) close(descriptor);
+		descriptor = -1;
+#endif
+		data = nullptr;
+	}
+
+	const char* data = nullptr;
+	size_t size = 0;
+#ifdef _WIN32
+	HANDLE file = INVALID_HANDLE_VALUE;
+	HANDLE mapping = NULL;
+#else
+	int descriptor = -1;
+#endif
+};
+
+class ChunkIndex {
+public:
+	//Reads dataPath once and writes the index for it to indexPath
+	static void Build(const std::string& dataPath, const std::string& indexPath, uint64_t chunkSize = 1 << 20) {
+		if (chunkSize == 0) throw std::invalid_argument("chunkSize can't be 0");
+		MappedFile file(dataPath);
+		Header header = MakeHeader(file, chunkSize);
+		DelimSpec spec = ParseDelimSpec(file.Data(), file.Size());
+		header.bodyStart = spec.bodyStart;
+		std::vector<Record> records = BuildRecords(file.Data(), file.Size(), spec, header);
+
+		std::ofstream out(indexPath, std::ios::binary | std::ios::trunc);
+		out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		out.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(Record));
+		if (!out) throw std::runtime_error("can't write " + indexPath);
+	}
+
+	ChunkIndex(const std::string& dataPath, const std::string& indexPath) :file(dataPath) {
+		std::ifstream in(indexPath, std::ios::binary);
+		Header expected = MakeHeader(file, 1);
+		if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) || std::memcmp(header.magic, expected.magic, sizeof(header.magic)) != 0 || header.version != expected.version || header.recordSize != sizeof(Record))
+			throw std::runtime_error(indexPath + " isn't a chunk index");
+		if (header.fileSize != expected.fileSize || header.fingerprint != expected.fingerprint || header.chunkSize == 0 || header.chunkCount != header.fileSize / header.chunkSize + 1)
+			throw std::runtime_error(indexPath + " was built for a different file");
+		records.resize(size_t(header.chunkCount));
+		if (!in.read(reinterpret_cast<char*>(records.data()), records.size() * sizeof(Record))) throw std::runtime_error(indexPath + " is truncated");
+		spec = ParseDelimSpec(file.Data(), file.Size());
+	}
+
+	//Sum of the numbers whose first character is in [first, last). Throws like Add() if one of them is negative
+	long long RangeSum(uint64_t first, uint64_t last) const {
+		last = std::min<uint64_t>(last, file.Size());
+		if (first >= last) return 0;
+		Prefix before = PrefixAt(first), upTo = PrefixAt(last);
+		if (upTo.negatives > before.negatives) throw NegativeNumberException(FirstNegative(first, last, before.negatives));
+		return upTo.sum - before.sum;
+	}
+
+	uint64_t ChunkSize() const { return header.chunkSize; }
+
+private:
+#pragma pack(push, 1)
+	struct Header {
+		char magic[8];
+		uint32_t version;
+		uint32_t recordSize;
+		uint64_t fileSize;
+		uint64_t chunkSize;
+		uint64_t chunkCount;	//one record for every multiple of chunkSize up to fileSize
+		uint64_t bodyStart;
+		uint64_t fingerprint;	//hash of a sample spread over the whole file, to catch an index that belongs to another file
+	};
+
+	struct Record {	//scan state just before the byte at chunk * chunkSize
+		int64_t sum;	//accepted numbers that start before this byte, including one that is still being read
+		uint64_t negatives;	//same for negatives
+		uint32_t delimSkip;	//bytes left of a delimiter that started before this byte
+		uint8_t inToken;	//a number started before this byte and hasn't ended yet
+		uint8_t padding[3];
+	};
+#pragma pack(pop)
+
+	struct Prefix {
+		long long sum;
+		uint64_t negatives;
+	};
+
+	static Header MakeHeader(const MappedFile& file, uint64_t chunkSize) {
+		Header header = Header();
+		std::memcpy(header.magic, "TDDCIDX", 8);
+		header.version = 2;
+		header.recordSize = sizeof(Record);
+		header.fileSize = file.Size();
+		header.chunkSize = chunkSize;
+		header.chunkCount = file.Size() / chunkSize + 1;
+		header.fingerprint = Fingerprint(file.Data(), file.Size());
+		return header;
+	}
+
+	static uint64_t Fingerprint(const char* data, size_t size) {	//the whole file if it's small, otherwise both ends and 256 slices in between
+		const size_t whole = 64 * 1024, edge = 4096, slices = 256, slice = 64;
+		if (size <= whole) return HashBytes(data, size);
+		uint64_t h = HashBytes(data, edge) ^ (HashBytes(data + size - edge, edge) * 31);
+		for (size_t i = 0; i < slices; ++i) h = (h * 31) ^ HashBytes(data + (size - slice) / (slices - 1) * i, slice);
+		return h;
+	}
+
+	static size_t DelimAt(const char* data, size_t size, const DelimSpec& spec, size_t i) {	//length of the delimiter found at i, 0 if i is part of a number
+		if (!spec.usingDelim) return isdigit(data[i]) ? 0 : 1;
+		for (const std::string& delim : spec.delimiters) {
+			if (delim.empty() || data[i] != delim.front() || size - i < delim.size()) continue;
+			if (std::memcmp(data + i, delim.data(), delim.size()) == 0) return delim.size();
+		}
+		return 0;
+	}
+
+	static std::vector<Record> BuildRecords(const char* data, size_t size, const DelimSpec& spec, const Header& header) {
+		std::vector<Record> records(size_t(header.chunkCount), Record());	//boundaries inside the delimiter declarations stay zero
+		size_t next = size_t(spec.bodyStart / header.chunkSize);
+		if (next * header.chunkSize < spec.bodyStart) ++next;
+
+		long long sum = 0;
+		uint64_t negatives = 0;
+		size_t tokenStart = 0;
+		bool inToken = false;
+		std::vector<size_t> waiting;	//records that have to include the number being read once we know its value
+
+		auto endToken = [&](size_t end) {
+			int value = ParseTokenValue(data + tokenStart, data + end);
+			long long accepted = (value >= 0 && value <= 1000) ? value : 0;
+			sum += accepted;
+			if (value < 0) ++negatives;
+			for (size_t i : waiting) {
+				records[i].sum += accepted;
+				if (value < 0) ++records[i].negatives;
+			}
+			waiting.clear();
+			inToken = false;
+		};
+
+		size_t pos = spec.bodyStart;
+		while (pos < size) {
+			if (next < records.size() && next * header.chunkSize == pos) {	//boundary right before this byte
+				records[next].sum = sum;
+				records[next].negatives = negatives;
+				records[next].inToken = inToken;
+				if (inToken) waiting.push_back(next);
+				++next;
+			}
+			size_t length = DelimAt(data, size, spec, pos);
+			if (length) {
+				if (inToken) endToken(pos);
+				for (; next < records.size() && next * header.chunkSize < pos + length; ++next) {	//boundaries inside the delimiter
+					records[next].sum = sum;
+					records[next].negatives = negatives;
+					records[next].delimSkip = uint32_t(pos + length - next * header.chunkSize);
+				}
+				pos += length;
+			}
+			else {
+				if (!inToken) {
+					inToken = true;
+					tokenStart = pos;
+				}
+				++pos;
+			}
+		}
+		if (inToken) endToken(size);
+		for (; next < records.size(); ++next) {	//a boundary at the very end of the file
+			records[next].sum = sum;
+			records[next].negatives = negatives;
+		}
+		return records;
+	}
+
+	//Picks the scan up at the start of chunk and calls onToken(start, value) for every number starting in [chunk start, last)
+	template <typename F>
+	void ScanChunk(size_t chunk, uint64_t last, F onToken) const {
+		const char* data = file.Data();
+		size_t size = file.Size();
+		const Record& record = records[chunk];
+		last = std::min<uint64_t>(last, size);
+		size_t pos = size_t(chunk * header.chunkSize);
+		if (pos < spec.bodyStart) pos = size_t(spec.bodyStart);
+		else {
+			pos += record.delimSkip;
+			if (record.inToken) while (pos < size && DelimAt(data, size, spec, pos) == 0) ++pos;	//already counted in the record, just find its end
+		}
+
+		while (pos < last) {
+			size_t length = DelimAt(data, size, spec, pos);
+			if (length) {
+				pos += length;
+				continue;
+			}
+			size_t start = pos;
+			while (pos < size && DelimAt(data, size, spec, pos) == 0) ++pos;
+			onToken(start, ParseTokenValue(data + start, data + pos));
+		}
+	}
+
+	Prefix PrefixAt(uint64_t position) const {	//numbers starting before position
+		size_t chunk = size_t(position / header.chunkSize);
+		const Record& record = records[chunk];
+		Prefix prefix = { record.sum, record.negatives };
+		ScanChunk(chunk, position, [&](size_t, int value) {
+			if (value < 0) ++prefix.negatives;
+			else if (value <= 1000) prefix.sum += value;
+		});
+		return prefix;
+	}
+
+	int FirstNegative(uint64_t first, uint64_t last, uint64_t negativesBefore) const {
+		//the records are sorted by negative count, so the first chunk boundary past the negative can be found with a binary search
+		auto after = std::upper_bound(records.begin() + size_t(first / header.chunkSize), records.end(), negativesBefore,
+			[](uint64_t count, const Record& record) { return count < record.negatives; });
+		size_t chunk = std::max<size_t>(size_t(first / header.chunkSize), size_t(after - records.begin()) - 1);
+		int found = 0;
+		for (; !found && chunk < records.size(); ++chunk) {	//each scan stops at the end of its chunk, so a negative near first doesn't read on to last
+			uint64_t chunkEnd = (chunk + 1) * header.chunkSize;
+			ScanChunk(chunk, std::min(last, chunkEnd), [&](size_t start, int value) {
+				if (!found && start >= first && value < 0) found = value;
+			});
+		}
+		return found;
+	}
+
+	MappedFile file;
+	Header header;
+	std::vector<Record> records;
+	DelimSpec spec;
+};
+
+long long IndexedSum(const std::string& numbers, uint64_t chunkSize, uint64_t first, uint64_t last) {
+	std::ofstream("test14.txt", std::ios::binary) << numbers;
+	ChunkIndex::Build("test14.txt", "test14.idx", chunkSize);
+	return ChunkIndex("test14.txt", "test14.idx").RangeSum(first, last);
+}
+
+BOOST_AUTO_TEST_CASE(test14) {
+	const char* inputs[] = { "1 2 3", "[,,][..]1..2,,3", "[\nn][...]1\nn1001|\nn1\n1 ,.(\nn1...1\n", "[;]23;/4;;7", "[;]", "[a][aa]1aaa2", "" };
+	for (const char* input : inputs) {
+		for (uint64_t chunkSize : { 1, 2, 3, 5, 64 }) BOOST_CHECK(IndexedSum(input, chunkSize, 0, 1000) == Add(input));
+	}
+	BOOST_CHECK(IndexedSum("[,,][..]1..2,,3..400,,5", 4, 17, 18) == 400);
+	BOOST_CHECK(IndexedSum("[,,][..]1..2,,3..400,,5", 4, 18, 100) == 5);
+	BOOST_CHECK_THROW(IndexedSum("[\n]3\n9\n-1", 2, 0, 100), NegativeNumberException);
+	BOOST_CHECK(IndexedSum("[\n]3\n9\n-1", 2, 0, 7) == 12);
+	std::remove("test14.txt");
+	std::remove("test14.idx");
+}
+
+BOOST_AUTO_TEST_CASE(test14_ranges) {
+	std::string numbers = "[ab][a][--]";
+	for (int i = 0; i < 400; ++i) numbers += std::to_string((i * 7919) % 1100) + (i % 3 == 0 ? "ab" : i % 3 == 1 ? "aa" : "--");
+	std::ofstream("test14.txt", std::ios::binary) << numbers;
+	ChunkIndex::Build("test14.txt", "test14.whole", 1 << 20);
+	ChunkIndex::Build("test14.txt", "test14.idx", 7);
+	ChunkIndex whole("test14.txt", "test14.whole"), chunked("test14.txt", "test14.idx");
+
+	BOOST_CHECK(chunked.RangeSum(0, numbers.size()) == Add(numbers));
+	for (uint64_t first = 0; first < numbers.size(); first += 13) {
+		for (uint64_t last = first; last <= numbers.size(); last += 17) {
+			BOOST_REQUIRE(chunked.RangeSum(first, last) == whole.RangeSum(first, last));
+			BOOST_REQUIRE(chunked.RangeSum(0, first) + chunked.RangeSum(first, last) == chunked.RangeSum(0, last));
+		}
+	}
+
+	std::string negatives = "[;]";
+	for (int i = 0; i < 1000; ++i) negatives += std::to_string(i % 50 == 49 ? -i : i) + ';';
+	std::ofstream("test14.txt", std::ios::binary) << negatives;
+	ChunkIndex::Build("test14.txt", "test14.idx", 16);
+	ChunkIndex index("test14.txt", "test14.idx");
+	for (uint64_t first = 0; first < negatives.size(); first += 97) {
+		size_t next = negatives.find('-', size_t(first));
+		try {
+			index.RangeSum(first, negatives.size());
+			BOOST_CHECK(next == std::string::npos);
+		}
+		catch (NegativeNumberException& e) {	//the first negative in the range, not just any
+			BOOST_REQUIRE(next != std::string::npos);
+			BOOST_CHECK(std::string(e.what()).find("(" + negatives.substr(next, negatives.find(';', next) - next) + ")") != std::string::npos);
+		}
+	}
+
+	std::ofstream("test14.txt", std::ios::binary) << numbers << "1";	//the index no longer matches the file
+	BOOST_CHECK_THROW(ChunkIndex("test14.txt", "test14.idx"), std::runtime_error);
+
+	std::string large;
+	while (large.size() < (1 << 20)) large += std::to_string(large.size() % 1000) + ',';
+	for (const std::string* original : { &numbers, &large }) {	//same size, one byte in the middle differs
+		std::string edited = *original;
+		size_t middle = original == &numbers ? numbers.size() / 2 : (large.size() - 64) / 255 * 128;	//one of the sampled slices
+		edited[middle] = edited[middle] == '7' ? '8' : '7';
+		std::ofstream("test14.txt", std::ios::binary) << *original;
+		ChunkIndex::Build("test14.txt", "test14.idx", 4096);
+		std::ofstream("test14.txt", std::ios::binary) << edited;
+		BOOST_CHECK_THROW(ChunkIndex("test14.txt", "test14.idx"), std::runtime_error);
+	}
+	std::remove("test14.txt");
+	std::remove("test14.idx");
+	std::remove("test14.whole");
+}
\ No newline at end of file
@@ -0,0 +1,354 @@
+#define BOOST_TEST_MODULE AddStringTest
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include "boost\test\unit_test.hpp"
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//16.
+//Keep the sum of the last N numbers (or the numbers in the last N bytes) of a stream that arrives in pieces.
+//Numbers and delimiters can be split between pieces, each new number should cost O(1) and memory should only depend on N
+// - Added StreamState, StreamFeed() and StreamFinish(), the scan from Add() fed a piece at a time. Bytes a delimiter might
+//	 start in are held back until the next piece arrives
+//	 Added WindowedSum, which keeps the numbers in the window in a ring buffer along with their running sum
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+struct StreamState {	//everything a streamed scan needs to carry on with the next piece
+	int stage = 0;	//0 nothing read yet, 1 reading delimiters, 2 reading numbers
+	bool usingDelim = false;
+	std::vector<std::string> delimiters;
+	size_t maxDelim = 1;
+	std::string pending;	//bytes we can't decide on until more arrive
+	std::string substring;	//the number being read
+	unsigned long long offset = 0;	//stream offset of pending.front()
+	unsigned long long tokenStart = 0;	//stream offset of substring.front()
+};
+
+//Reads the next piece of the stream, calling onToken(substring, offset) for every number that is known to have ended.
+//final means nothing else is coming, so nothing is held back
+template <typename F>
+void StreamFeed(StreamState& state, const char* data, size_t size, F onToken, bool final = false) {
+	std::string& pending = state.pending;
+	pending.append(data, size);
+	size_t i = 0;
+
+	if (state.stage == 0 && pending.size()) {	//the first character decides if there are delimiters, like the top of Add()
+		state.usingDelim = !isdigit(pending.front());
+		state.stage = state.usingDelim ? 1 : 2;
+		if (state.usingDelim) state.delimiters.assign(1, "");
+	}
+
+	while (state.stage == 1 && i < pending.size()) {
+		if (pending[i] == '[') {
+			++i;
+			continue;
+		}
+		if (pending[i] == ']') {
+			if ((i + 1) >= pending.size() && !final) break;	//need the next character to know if another delim follows
+			if ((i + 1) < pending.size() && pending[i + 1] != '[') {
+				state.stage = 2;
+				for (const std::string& delim : state.delimiters) state.maxDelim = std::max(state.maxDelim, delim.size());
+			}
+			else state.delimiters.push_back("");
+			++i;
+			continue;
+		}
+		state.delimiters[state.delimiters.size() - 1] += pending[i++];
+	}
+
+	while (state.stage == 2 && i < pending.size()) {
+		size_t delimLength = 0;
+		if (!state.usingDelim) delimLength = isdigit(pending[i]) ? 0 : 1;
+		else {
+			if (pending.size() - i < state.maxDelim && !final) break;	//a delim might start here and end in the next piece
+			for (const std::string& delim : state.delimiters) {
+				if (delim.size() && pending[i] == delim.front() && pending.compare(i, delim.size(), delim) == 0) {
+					delimLength = delim.size();
+					break;
+				}
+			}
+		}
+
+		if (delimLength) {
+			if (state.substring != "") {
+				onToken(state.substring, state.tokenStart);
+				state.substring = "";
+			}
+			i += delimLength;
+		}
+		else {
+			if (state.substring == "") state.tokenStart = state.offset + i;
+			state.substring += pending[i++];
+		}
+	}
+
+	pending.erase(0, i);
+	state.offset += i;
+}
+
+template <typename F>
+void StreamFinish(StreamState& state, F onToken) {	//end of the stream, hands out whatever was held back
+	StreamFeed(state, nullptr, 0, onToken, true);
+	if (state.substring != "") {
+		onToken(state.substring, state.tokenStart);
+		state.substring = "";
+	}
+}
+
+class WindowedSum {
+public:
+	enum Mode {
+		LastNumbers,	//the window is the last N numbers
+		LastBytes	//the window is the numbers that start in the last N bytes
+	};
+
+	explicit WindowedSum(size_t window, Mode mode = LastNumbers) :ring(std::max<size_t>(window, 1)), window(window), mode(mode) {}
+
+	//Adds the next piece of the stream. A number isn't in the window until the delimiter after it arrives. Negatives are left
+	//out of the window and thrown once the rest of the piece has been read, so the stream can carry on afterwards
+	void Feed(const char* data, size_t size) {
+		bool negative = false;
+		int firstNegative = 0;
+		StreamFeed(state, data, size, [&](const std::string& substring, unsigned long long offset) {
+			int value = ParseNumber(substring);
+			if (value < 0) {
+				if (!negative) firstNegative = value;
+				negative = true;
+				return;
+			}
+			Push(value > 1000 ? 0 : value, offset);	//numbers over 1000 count as 0, the same as StringToNumber()
+		});
+		received += size;
+		if (mode == LastBytes) {
+			while (count && (received > window && Oldest().offset < received - window)) Pop();
+		}
+		if (negative) throw NegativeNumberException(firstNegative);
+	}
+
+	void Feed(const std::string& piece) { Feed(piece.data(), piece.size()); }
+
+	long long Sum() const { return sum; }
+	size_t Count() const { return count; }
+
+private:
+	struct Entry {
+		int value;
+		unsigned long long offset;
+	};
+
+	static int ParseNumber(const std::string& s) {	//StringToNumber() without the checks, they are done by Feed()
+		std::stringstream ss(s);
+		int result = 0;
+		ss >> result;
+		return result;
+	}
+
+	Entry& Oldest() { return ring[(head + ring.size() - count) % ring.size()]; }
+
+	void Push(int value, unsigned long long offset) {
+		if (count == ring.size()) Pop();	//window is full, the oldest number drops out
+		ring[head] = Entry{ value, offset };
+		head = (head + 1) % ring.size();
+		++count;
+		sum += value;
+	}
+
+	void Pop() {
+		sum -= Oldest().value;
+		--count;
+	}
+
+	std::vector<Entry> ring;	//a number starts at every entry, so N bytes never hold more than N of them
+	size_t head = 0;	//where the next number goes
+	size_t count = 0;
+	long long sum = 0;
+	size_t window;
+	Mode mode;
+	unsigned long long received = 0;
+	StreamState state;
+};
+
+BOOST_AUTO_TEST_CASE(test16) {
+	const char* inputs[] = { "1 2 3", "[,,][..]1..2,,3", "[\nn][...]1\nn1001|\nn1\n1 ,.(\nn1...1\n", "[;]23;/4;;7", "[;]", "", "[a][aa]1aaa2", "[]]1]2" };
+	for (const char* input : inputs) {
+		std::string numbers = input;
+		for (size_t piece = 1; piece <= numbers.size() + 1; ++piece) {	//every way of cutting it into equal pieces
+			StreamState state;
+			int result = 0;
+			auto onToken = [&](const std::string& substring, unsigned long long) { result += StringToNumber<int>(substring); };
+			for (size_t i = 0; i < numbers.size(); i += piece) StreamFeed(state, numbers.data() + i, std::min(piece, numbers.size() - i), onToken);
+			StreamFinish(state, onToken);
+			BOOST_CHECK(result == Add(numbers));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(test16_window) {
+	std::string numbers = "[ab][a][--]";
+	std::vector<int> values;
+	for (int i = 0; i < 300; ++i) {
+		values.push_back((i * 7919) % 1100);
+		numbers += std::to_string(values.back()) + (i % 3 == 0 ? "ab" : i % 3 == 1 ? "aa" : "--");
+	}
+
+	WindowedSum window(10);
+	size_t fed = 0;
+	for (size_t piece = 1; fed < numbers.size(); piece = piece % 7 + 1) {
+		size_t size = std::min(piece, numbers.size() - fed);
+		window.Feed(numbers.data() + fed, size);
+		fed += size;
+	}
+	long long expected = 0;
+	for (size_t i = values.size() - 10; i < values.size(); ++i) expected += values[i] > 1000 ? 0 : values[i];
+	BOOST_CHECK(window.Count() == 10);
+	BOOST_CHECK(window.Sum() == expected);
+
+	WindowedSum bytes(5, WindowedSum::LastBytes);
+	bytes.Feed("10,20,3");
+	BOOST_CHECK(bytes.Sum() == 20);	//3 hasn't ended yet and 10 starts more than 5 bytes ago
+	bytes.Feed("0,");
+	BOOST_CHECK(bytes.Count() == 1 && bytes.Sum() == 30);
+	bytes.Feed("[;]");	//once numbers have started these are just more non digits
+	BOOST_CHECK(bytes.Count() == 0 && bytes.Sum() == 0);
+
+	WindowedSum negatives(3);
+	BOOST_CHECK_THROW(negatives.Feed("[;]3;-9;4;"), NegativeNumberException);
+	BOOST_CHECK(negatives.Sum() == 7);	//the stream keeps going after a negative
+	negatives.Feed("5;");
+	BOOST_CHECK(negatives.Sum() == 12);
+}
\ No newline at end of file
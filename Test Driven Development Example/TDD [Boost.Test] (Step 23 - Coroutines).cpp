@@ -0,0 +1,666 @@
+#define BOOST_TEST_MODULE AddStringTest
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include "boost\test\unit_test.hpp"
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//23.
+//Give coroutine based services a way to add without blocking their event loop (needs C++20). co_await calc.add_async(source) reads
+//the input a slice at a time, lets other coroutines run between slices, waits for more data from an async source and sends huge
+//inputs to a worker pool on its own
+// - Added Task<T>, a lazily started coroutine that can be awaited, a Scheduler that resumes coroutines on the thread calling Run(),
+//	 and a WorkerPool whose Run() resumes the awaiting coroutine back on the scheduler with the result
+// - Added AsyncSource with StringSource and ChannelSource (pieces pushed from any thread), and Calculator::add_async() for either
+//	 a source or a string. Strings of AsyncOptions::offloadSize bytes or more go to the pool when there is one
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+struct StreamState {	//everything a streamed scan needs to carry on with the next piece
+	int stage = 0;	//0 nothing read yet, 1 reading delimiters, 2 reading numbers
+	bool usingDelim = false;
+	std::vector<std::string> delimiters;
+	size_t maxDelim = 1;
+	std::string pending;	//bytes we can't decide on until more arrive
+	std::string substring;	//the number being read
+	unsigned long long offset = 0;	//stream offset of pending.front()
+	unsigned long long tokenStart = 0;	//stream offset of substring.front()
+};
+
+//Reads the next piece of the stream, calling onToken(substring, offset) for every number that is known to have ended.
+//final means nothing else is coming, so nothing is held back
+template <typename F>
+void StreamFeed(StreamState& state, const char* data, size_t size, F onToken, bool final = false) {
+	std::string& pending = state.pending;
+	pending.append(data, size);
+	size_t i = 0;
+
+	if (state.stage == 0 && pending.size()) {	//the first character decides if there are delimiters, like the top of Add()
+		state.usingDelim = !isdigit(pending.front());
+		state.stage = state.usingDelim ? 1 : 2;
+		if (state.usingDelim) state.delimiters.assign(1, "");
+	}
+
+	while (state.stage == 1 && i < pending.size()) {
+		if (pending[i] == '[') {
+			++i;
+			continue;
+		}
+		if (pending[i] == ']') {
+			if ((i + 1) >= pending.size() && !final) break;	//need the next character to know if another delim follows
+			if ((i + 1) < pending.size() && pending[i + 1] != '[') {
+				state.stage = 2;
+				for (const std::string& delim : state.delimiters) state.maxDelim = std::max(state.maxDelim, delim.size());
+			}
+			else state.delimiters.push_back("");
+			++i;
+			continue;
+		}
+		state.delimiters[state.delimiters.size() - 1] += pending[i++];
+	}
+
+	while (state.stage == 2 && i < pending.size()) {
+		size_t delimLength = 0;
+		if (!state.usingDelim) delimLength = isdigit(pending[i]) ? 0 : 1;
+		else {
+			if (pending.size() - i < state.maxDelim && !final) break;	//a delim might start here and end in the next piece
+			for (const std::string& delim : state.delimiters) {
+				if (delim.size() && pending[i] == delim.front() && pending.compare(i, delim.size(), delim) == 0) {
+					delimLength = delim.size();
+					break;
+				}
+			}
+		}
+
+		if (delimLength) {
+			if (state.substring != "") {
+				onToken(state.substring, state.tokenStart);
+				state.substring = "";
+			}
+			i += delimLength;
+		}
+		else {
+			if (state.substring == "") state.tokenStart = state.offset + i;
+			state.substring += pending[i++];
+		}
+	}
+
+	pending.erase(0, i);
+	state.offset += i;
+}
+
+template <typename F>
+void StreamFinish(StreamState& state, F onToken) {	//end of the stream, hands out whatever was held back
+	StreamFeed(state, nullptr, 0, onToken, true);
+	if (state.substring != "") {
+		onToken(state.substring, state.tokenStart);
+		state.substring = "";
+	}
+}
+
+template <typename T>
+class Task;
+
+template <typename T>
+struct TaskPromiseBase {
+	std::exception_ptr error;
+	std::coroutine_handle<> continuation;	//whoever is awaiting the task
+
+	std::suspend_always initial_suspend() noexcept { return {}; }	//nothing runs until the task is awaited
+
+	struct FinalAwaiter {
+		bool await_ready() noexcept { return false; }
+		template <typename P>
+		std::coroutine_handle<> await_suspend(std::coroutine_handle<P> finished) noexcept {	//go straight back to the awaiting coroutine
+			std::coroutine_handle<> next = finished.promise().continuation;
+			return next ? next : std::noop_coroutine();
+		}
+		void await_resume() noexcept {}
+	};
+	FinalAwaiter final_suspend() noexcept { return {}; }
+
+	void unhandled_exception() { error = std::current_exception(); }
+};
+
+template <typename T>
+struct TaskPromise : TaskPromiseBase<T> {
+	std::optional<T> value;
+
+	Task<T> get_return_object();
+	void return_value(T result) { value = std::move(result); }
+	T Result() {
+		if (this->error) std::rethrow_exception(this->error);
+		return std::move(*value);
+	}
+};
+
+template <>
+struct TaskPromise<void> : TaskPromiseBase<void> {
+	Task<void> get_return_object();
+	void return_void() {}
+	void Result() {
+		if (error) std::rethrow_exception(error);
+	}
+};
+
+template <typename T>
+class Task {
+public:
+	using promise_type = TaskPromise<T>;
+
+	explicit Task(std::coroutine_handle<promise_type> handle) :handle(handle) {}
+	Task(Task&& other) noexcept :handle(other.handle) { other.handle = nullptr; }
+	Task(const Task&) = delete;
+	Task& operator=(const Task&) = delete;
+	~Task() {
+		if (handle) handle.destroy();
+	}
+
+	bool await_ready() const noexcept { return false; }
+	std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+		handle.promise().continuation = awaiting;
+		return handle;	//start the task, it resumes awaiting when it finishes
+	}
+	T await_resume() { return handle.promise().Result(); }
+
+private:
+	std::coroutine_handle<promise_type> handle;
+};
+
+template <typename T>
+Task<T> TaskPromise<T>::get_return_object() { return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this)); }
+
+inline Task<void> TaskPromise<void>::get_return_object() { return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this)); }
+
+struct Detached {	//a coroutine nobody awaits, it starts right away and cleans itself up
+	struct promise_type {
+		Detached get_return_object() { return {}; }
+		std::suspend_never initial_suspend() noexcept { return {}; }
+		std::suspend_never final_suspend() noexcept { return {}; }
+		void return_void() {}
+		void unhandled_exception() { std::terminate(); }
+	};
+};
+
+class Scheduler {	//resumes coroutines one at a time on the thread that calls Run()
+public:
+	void Post(std::coroutine_handle<> handle) {	//can be called from any thread
+		std::lock_guard<std::mutex> lock(mutex);
+		ready.push_back(handle);
+		changed.notify_one();
+	}
+
+	auto Schedule() {	//co_await scheduler.Schedule() lets everything else that is ready run first
+		struct Awaiter {
+			Scheduler& scheduler;
+			bool await_ready() const noexcept { return false; }
+			void await_suspend(std::coroutine_handle<> handle) { scheduler.Post(handle); }
+			void await_resume() const noexcept {}
+		};
+		return Awaiter{ *this };
+	}
+
+	void Spawn(Task<void> task) {	//runs alongside whatever Run() is waiting for, exceptions are thrown out of Run()
+		Drive(this, std::move(task), nullptr);
+	}
+
+	template <typename T>
+	T Run(Task<T> task) {	//runs coroutines until task has finished
+		std::optional<T> result;
+		bool done = false;
+		Drive(this, std::move(task), &result, &done);
+		Drain(done);
+		return std::move(*result);
+	}
+
+	void Run(Task<void> task) {
+		bool done = false;
+		Drive(this, std::move(task), &done);
+		Drain(done);
+	}
+
+private:
+	template <typename T>
+	static Detached Drive(Scheduler* scheduler, Task<T> task, std::optional<T>* result, bool* done) {
+		try {
+			*result = co_await task;
+		}
+		catch (...) {
+			scheduler->Fail(std::current_exception());
+		}
+		*done = true;
+	}
+
+	static Detached Drive(Scheduler* scheduler, Task<void> task, bool* done) {
+		try {
+			co_await task;
+		}
+		catch (...) {
+			scheduler->Fail(std::current_exception());
+		}
+		if (done) *done = true;
+	}
+
+	void Fail(std::exception_ptr failure) {
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!error) error = failure;
+	}
+
+	void Drain(const bool& done) {
+		for (;;) {
+			std::coroutine_handle<> next;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				if (error) {
+					std::exception_ptr failure = error;
+					error = nullptr;
+					std::rethrow_exception(failure);
+				}
+				if (done) return;
+				changed.wait(lock, [this]() { return ready.size() || error; });	//a worker thread or a source will post the next one
+				if (ready.empty()) continue;
+				next = ready.front();
+				ready.pop_front();
+			}
+			next.resume();
+		}
+	}
+
+	std::deque<std::coroutine_handle<>> ready;
+	std::mutex mutex;
+	std::condition_variable changed;
+	std::exception_ptr error;
+};
+
+class WorkerPool {
+public:
+	explicit WorkerPool(unsigned threads = std::thread::hardware_concurrency()) {
+		for (unsigned i = 0; i < std::max(threads, 1u); ++i) workers.emplace_back([this]() { Work(); });
+	}
+
+	~WorkerPool() {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+		}
+		changed.notify_all();
+		for (std::thread& worker : workers) worker.join();
+	}
+
+	void Submit(std::function<void()> job) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			jobs.push_back(std::move(job));
+		}
+		changed.notify_one();
+	}
+
+	template <typename F>
+	auto Run(Scheduler& scheduler, F job) {	//co_await pool.Run(scheduler, job) runs job on a worker and carries on back on the scheduler
+		using R = std::invoke_result_t<F>;
+		struct Awaiter {
+			WorkerPool& pool;
+			Scheduler& scheduler;
+			F job;
+			std::optional<R> result;
+			std::exception_ptr error;
+
+			bool await_ready() const noexcept { return false; }
+			void await_suspend(std::coroutine_handle<> handle) {
+				pool.Submit([this, handle]() {
+					try {
+						result = job();
+					}
+					catch (...) {
+						error = std::current_exception();
+					}
+					scheduler.Post(handle);
+				});
+			}
+			R await_resume() {
+				if (error) std::rethrow_exception(error);
+				return std::move(*result);
+			}
+		};
+		return Awaiter{ *this, scheduler, std::move(job), std::nullopt, nullptr };
+	}
+
+private:
+	void Work() {
+		for (;;) {
+			std::function<void()> job;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				changed.wait(lock, [this]() { return stopping || jobs.size(); });
+				if (jobs.empty()) return;
+				job = std::move(jobs.front());
+				jobs.pop_front();
+			}
+			job();
+		}
+	}
+
+	std::vector<std::thread> workers;
+	std::deque<std::function<void()>> jobs;
+	std::mutex mutex;
+	std::condition_variable changed;
+	bool stopping = false;
+};
+
+class AsyncSource {	//where add_async() gets its input
+public:
+	virtual ~AsyncSource() {}
+	virtual Task<size_t> Read(char* out, size_t size) = 0;	//up to size bytes, 0 once the input has ended
+};
+
+class StringSource : public AsyncSource {	//input that is all there already
+public:
+	explicit StringSource(const std::string& numbers) :numbers(numbers) {}
+
+	Task<size_t> Read(char* out, size_t size) override {
+		size_t length = std::min(size, numbers.size() - used);
+		std::copy(numbers.begin() + used, numbers.begin() + used + length, out);
+		used += length;
+		co_return length;
+	}
+
+private:
+	const std::string& numbers;
+	size_t used = 0;
+};
+
+class ChannelSource : public AsyncSource {	//input pushed a piece at a time, from any thread
+public:
+	explicit ChannelSource(Scheduler& scheduler) :scheduler(scheduler) {}
+
+	void Push(std::string piece) {
+		std::lock_guard<std::mutex> lock(mutex);
+		pieces.push_back(std::move(piece));
+		WakeReader();
+	}
+
+	void Close() {	//no more pieces are coming
+		std::lock_guard<std::mutex> lock(mutex);
+		closed = true;
+		WakeReader();
+	}
+
+	Task<size_t> Read(char* out, size_t size) override {
+		co_await Arrival{ *this };
+		std::lock_guard<std::mutex> lock(mutex);
+		size_t length = 0;
+		while (length < size && pieces.size()) {
+			const std::string& piece = pieces.front();
+			size_t take = std::min(size - length, piece.size() - used);
+			std::copy(piece.begin() + used, piece.begin() + used + take, out + length);
+			length += take;
+			used += take;
+			if (used == piece.size()) {
+				pieces.pop_front();
+				used = 0;
+			}
+		}
+		co_return length;
+	}
+
+private:
+	struct Arrival {	//waits until there is a piece or the channel is closed
+		ChannelSource& source;
+		bool await_ready() {
+			std::lock_guard<std::mutex> lock(source.mutex);
+			return source.pieces.size() || source.closed;
+		}
+		bool await_suspend(std::coroutine_handle<> handle) {
+			std::lock_guard<std::mutex> lock(source.mutex);
+			if (source.pieces.size() || source.closed) return false;	//arrived in the meantime, carry on
+			source.reader = handle;
+			return true;
+		}
+		void await_resume() const noexcept {}
+	};
+
+	void WakeReader() {
+		if (!reader) return;
+		scheduler.Post(reader);	//the reader is resumed on the scheduler, not on the pushing thread
+		reader = nullptr;
+	}
+
+	Scheduler& scheduler;
+	std::deque<std::string> pieces;
+	size_t used = 0;	//bytes of pieces.front() already read
+	bool closed = false;
+	std::coroutine_handle<> reader;
+	std::mutex mutex;
+};
+
+struct AsyncOptions {
+	size_t sliceSize = 64 << 10;	//bytes scanned before letting other coroutines run
+	size_t offloadSize = 4 << 20;	//strings at least this long go to the worker pool
+};
+
+class Calculator {
+public:
+	Calculator(Scheduler& scheduler, WorkerPool* pool = nullptr, AsyncOptions options = AsyncOptions()) :scheduler(scheduler), pool(pool), options(options) {}
+
+	Task<int> add_async(AsyncSource& source) {	//same result as Add(), source has to outlive the task
+		StreamState state;
+		int sum = 0;
+		auto onToken = [&sum](const std::string& substring, unsigned long long) { sum += StringToNumber<int>(substring); };
+		std::vector<char> slice(std::max<size_t>(options.sliceSize, 1));
+		for (;;) {
+			size_t length = co_await source.Read(slice.data(), slice.size());
+			if (length == 0) break;
+			StreamFeed(state, slice.data(), length, onToken);
+			co_await scheduler.Schedule();
+		}
+		StreamFinish(state, onToken);
+		co_return sum;
+	}
+
+	Task<int> add_async(std::string numbers) {
+		if (pool && numbers.size() >= options.offloadSize) co_return co_await pool->Run(scheduler, [&numbers]() { return Add(std::move(numbers)); });
+		StringSource source(numbers);
+		co_return co_await add_async(source);
+	}
+
+private:
+	Scheduler& scheduler;
+	WorkerPool* pool;
+	AsyncOptions options;
+};
+
+Task<void> Ticker(Scheduler& scheduler, const bool& stop, int& ticks) {	//counts how often it gets to run
+	while (!stop) {
+		++ticks;
+		co_await scheduler.Schedule();
+	}
+}
+
+Task<void> Timed(Calculator& calc, std::string numbers, bool& stop, int& result) {
+	result = co_await calc.add_async(std::move(numbers));
+	stop = true;
+}
+
+BOOST_AUTO_TEST_CASE(test23) {
+	std::vector<std::string> inputs = { "1 2 3", "", "[,,][..]1..2,,3", "[\nn][...]1\nn1001|\nn1\n1 ,.(\nn1...1\n", "[;]23;/4;;7" };
+	std::string big = "[;;]";
+	for (int i = 0; i < 100000; ++i) big += std::to_string(i % 1500) + ";;";
+	inputs.push_back(big);
+
+	Scheduler scheduler;
+	WorkerPool pool(2);
+	AsyncOptions options;
+	options.sliceSize = 5;
+	options.offloadSize = 1 << 20;
+	Calculator calc(scheduler, &pool, options);
+	for (const std::string& numbers : inputs) BOOST_CHECK(scheduler.Run(calc.add_async(numbers)) == Add(numbers));
+	BOOST_CHECK_THROW(scheduler.Run(calc.add_async("[\n]3\n9\n-1")), NegativeNumberException);
+
+	int ticks = 0, result = 0;	//slices give other coroutines a turn
+	bool stop = false;
+	scheduler.Spawn(Ticker(scheduler, stop, ticks));
+	scheduler.Run(Timed(calc, big, stop, result));
+	BOOST_CHECK(result == Add(big) && ticks > 1000);
+
+	std::string huge;	//goes to the pool, the scheduler keeps running while it is added up
+	while (huge.size() < options.offloadSize) huge += big;
+	ticks = 0;
+	stop = false;
+	scheduler.Spawn(Ticker(scheduler, stop, ticks));
+	scheduler.Run(Timed(calc, huge, stop, result));
+	BOOST_CHECK(result == Add(huge) && ticks > 0);
+	BOOST_CHECK_THROW(scheduler.Run(calc.add_async(huge + "-1")), NegativeNumberException);
+
+	for (size_t piece : { 1, 3, 64 }) {	//pieces from another thread, the reader waits for them
+		ChannelSource source(scheduler);
+		std::thread producer([&]() {
+			for (size_t i = 0; i < big.size(); i += piece) source.Push(big.substr(i, piece));
+			source.Close();
+		});
+		BOOST_CHECK(scheduler.Run(calc.add_async(source)) == Add(big));
+		producer.join();
+	}
+}
\ No newline at end of file
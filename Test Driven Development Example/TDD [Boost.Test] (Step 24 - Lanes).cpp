@@ -0,0 +1,342 @@
+#define BOOST_TEST_MODULE AddStringTest
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include "boost\test\unit_test.hpp"
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//24.
+//Most requests are tiny, like "1,2" or "[;]3;4", so the time goes on per call overhead and a single input is too short to vectorize.
+//Lay up to 16 short inputs side by side, one per lane, and step every lane through the digit and delimiter states at once
+// - Added AddBatch() (see Step 19) which sends each input without delimiters or with a single [c] delimiter, and a body shorter
+//	 than LaneBytes, to the lane kernel and everything else to Add()
+// - Added LaneGroup, the inputs transposed so each position is a row of 16 lanes, and SumLanes() which runs the Add() rules over
+//	 the rows with SSE2 (a loop over the lanes without it). A lane that finds a negative is done again by Add() for the exception
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TDD_SSE2
+#include <emmintrin.h>
+#endif
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :number(number), msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+
+	int number;	//the negative that was passed
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+struct BatchResult {
+	bool ok;	//false if a negative was found
+	int value;	//the sum, or the negative if ok is false
+};
+
+BatchResult AddScalar(const std::string& numbers) {
+	try {
+		return BatchResult{ true, Add(numbers) };
+	}
+	catch (NegativeNumberException& e) {
+		return BatchResult{ false, e.number };
+	}
+}
+
+const size_t LaneCount = 16;
+const size_t LaneBytes = 32;	//rows in a group, a body has to be shorter so every lane ends on a delimiter
+
+struct LaneGroup {
+	alignas(16) int16_t rows[LaneBytes][LaneCount];	//rows[position][lane], past the end of a body it is filled with the lane's delimiter
+	alignas(16) int16_t delims[LaneCount];	//-1 for a lane with no delimiters, any non digit splits
+	size_t used = 0;	//lanes filled
+	size_t rowCount = 1;	//rows the longest body needs
+	size_t inputs[LaneCount];	//index of each lane's input in the batch
+};
+
+//Where the body starts if the lane kernel can take numbers, otherwise npos
+size_t LaneBody(const std::string& numbers, int16_t& delim) {
+	if (numbers.empty() || (numbers.front() >= '0' && numbers.front() <= '9')) {
+		delim = -1;
+		return numbers.size() < LaneBytes ? 0 : std::string::npos;
+	}
+	if (numbers.size() < 3 || numbers[0] != '[' || numbers[2] != ']' || numbers[1] == '[' || numbers[1] == ']') return std::string::npos;
+	if (numbers.size() > 3 && numbers[3] == '[') return std::string::npos;	//more than one delimiter
+	delim = int16_t(uint8_t(numbers[1]));
+	return numbers.size() - 3 < LaneBytes ? 3 : std::string::npos;
+}
+
+void AddLane(LaneGroup& group, const std::string& numbers, size_t body, int16_t delim, size_t input) {
+	size_t lane = group.used++;
+	size_t length = numbers.size() - body;
+	int16_t pad = delim < 0 ? int16_t(',') : delim;
+	for (size_t row = 0; row < LaneBytes; ++row) group.rows[row][lane] = row < length ? int16_t(uint8_t(numbers[body + row])) : pad;
+	group.delims[lane] = delim;
+	group.inputs[lane] = input;
+	group.rowCount = std::max(group.rowCount, length + 1);
+}
+
+//Runs the rules of Add() and StringToNumber() on every lane: a number may start with whitespace and a sign, then takes digits until
+//anything else. Values are kept at 1001 or less, which is all the over 1000 rule needs. bad is set for a lane that found a negative
+void SumLanes(const LaneGroup& group, int16_t* sums, int16_t* bad) {
+#ifdef TDD_SSE2
+	for (size_t half = 0; half < LaneCount; half += 8) {
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i all = _mm_set1_epi16(-1);
+		const __m128i delims = _mm_load_si128(reinterpret_cast<const __m128i*>(group.delims + half));
+		const __m128i noDelim = _mm_cmpeq_epi16(delims, all);
+		__m128i phase = zero;	//0 before the number, 1 after a sign, 2 in the digits, 3 ignoring the rest
+		__m128i negative = zero, value = zero, sum = zero, found = zero;
+
+		for (size_t row = 0; row < group.rowCount; ++row) {
+			__m128i c = _mm_load_si128(reinterpret_cast<const __m128i*>(group.rows[row] + half));
+			__m128i digit = _mm_sub_epi16(c, _mm_set1_epi16('0'));
+			__m128i isDigit = _mm_and_si128(_mm_cmpgt_epi16(digit, all), _mm_cmplt_epi16(digit, _mm_set1_epi16(10)));
+			__m128i isDelim = _mm_or_si128(_mm_and_si128(noDelim, _mm_xor_si128(isDigit, all)), _mm_andnot_si128(noDelim, _mm_cmpeq_epi16(c, delims)));
+			__m128i isSpace = _mm_or_si128(_mm_cmpeq_epi16(c, _mm_set1_epi16(' ')), _mm_and_si128(_mm_cmpgt_epi16(c, _mm_set1_epi16(8)), _mm_cmplt_epi16(c, _mm_set1_epi16(14))));
+			__m128i isMinus = _mm_cmpeq_epi16(c, _mm_set1_epi16('-'));
+			__m128i isSign = _mm_or_si128(isMinus, _mm_cmpeq_epi16(c, _mm_set1_epi16('+')));
+			__m128i before = _mm_cmpeq_epi16(phase, zero);
+
+			//a delimiter ends the number
+			found = _mm_or_si128(found, _mm_and_si128(isDelim, _mm_and_si128(negative, _mm_cmpgt_epi16(value, zero))));
+			sum = _mm_add_epi16(sum, _mm_and_si128(isDelim, _mm_and_si128(value, _mm_cmplt_epi16(value, _mm_set1_epi16(1001)))));
+
+			__m128i sign = _mm_andnot_si128(isDelim, _mm_and_si128(before, isSign));
+			__m128i step = _mm_andnot_si128(isDelim, _mm_and_si128(isDigit, _mm_cmplt_epi16(phase, _mm_set1_epi16(3))));
+			__m128i wait = _mm_andnot_si128(isDelim, _mm_and_si128(before, isSpace));
+			__m128i stop = _mm_andnot_si128(_mm_or_si128(_mm_or_si128(isDelim, sign), _mm_or_si128(step, wait)), all);
+
+			__m128i stepped = _mm_min_epi16(_mm_add_epi16(_mm_mullo_epi16(value, _mm_set1_epi16(10)), digit), _mm_set1_epi16(1001));
+			value = _mm_or_si128(_mm_and_si128(step, stepped), _mm_andnot_si128(_mm_or_si128(step, isDelim), value));
+			negative = _mm_or_si128(_mm_and_si128(sign, isMinus), _mm_andnot_si128(_mm_or_si128(sign, isDelim), negative));
+			phase = _mm_andnot_si128(isDelim, phase);
+			phase = _mm_or_si128(_mm_andnot_si128(_mm_or_si128(sign, _mm_or_si128(step, stop)), phase),
+				_mm_or_si128(_mm_and_si128(sign, _mm_set1_epi16(1)), _mm_or_si128(_mm_and_si128(step, _mm_set1_epi16(2)), _mm_and_si128(stop, _mm_set1_epi16(3)))));
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(sums + half), sum);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(bad + half), found);
+	}
+#else
+	for (size_t lane = 0; lane < LaneCount; ++lane) {
+		int16_t delim = group.delims[lane];
+		int phase = 0, value = 0;
+		bool negative = false;
+		sums[lane] = 0;
+		bad[lane] = 0;
+		for (size_t row = 0; row < group.rowCount; ++row) {
+			int c = group.rows[row][lane];
+			bool isDigit = c >= '0' && c <= '9';
+			if (delim < 0 ? !isDigit : c == delim) {
+				if (negative && value > 0) bad[lane] = -1;
+				if (value <= 1000) sums[lane] += int16_t(value);
+				phase = value = 0;
+				negative = false;
+			}
+			else if (phase == 0 && (c == '-' || c == '+')) {
+				phase = 1;
+				negative = c == '-';
+			}
+			else if (phase < 3 && isDigit) {
+				phase = 2;
+				value = std::min(value * 10 + (c - '0'), 1001);
+			}
+			else if (!(phase == 0 && (c == ' ' || (c >= '\t' && c <= '\r')))) phase = 3;
+		}
+	}
+#endif
+}
+
+void FlushLanes(LaneGroup& group, const std::string* inputs, BatchResult* results) {
+	int16_t sums[LaneCount], bad[LaneCount];
+	SumLanes(group, sums, bad);
+	for (size_t lane = 0; lane < group.used; ++lane) {
+		size_t input = group.inputs[lane];
+		results[input] = bad[lane] ? AddScalar(inputs[input]) : BatchResult{ true, sums[lane] };
+	}
+	group.used = 0;
+	group.rowCount = 1;
+}
+
+void AddBatch(const std::string* inputs, size_t count, BatchResult* results) {
+	LaneGroup group;
+	for (size_t i = 0; i < count; ++i) {
+		int16_t delim;
+		size_t body = LaneBody(inputs[i], delim);
+		if (body == std::string::npos) {
+			results[i] = AddScalar(inputs[i]);
+			continue;
+		}
+		AddLane(group, inputs[i], body, delim, i);
+		if (group.used == LaneCount) FlushLanes(group, inputs, results);
+	}
+	if (group.used) {
+		for (size_t lane = group.used; lane < LaneCount; ++lane) {	//lanes nobody uses are all delimiters
+			for (size_t row = 0; row < LaneBytes; ++row) group.rows[row][lane] = ',';
+			group.delims[lane] = -1;
+		}
+		FlushLanes(group, inputs, results);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(test24) {
+	std::vector<std::string> inputs = { "1 2 3", "", "1,2", "[;]3;4", "[;]", "[;]23;/4;;7", "[,,][..]1..2,,3", "[\n]3\n9\n-1", "[-]1-2", "[5]15253",
+		"1001,1000", "[;] 7; +8;- 9;-0;+-1", "99999999999999,1", "[;]-99999999999", "[;]1;2[", std::string("[\0]4\0\0" "5", 8) };
+	std::mt19937 random(24);
+	const char alphabet[] = "0123456789;,- +x\n\t[]";
+	for (int i = 0; i < 200000; ++i) {	//random short inputs, most of them go through the lanes
+		std::string numbers;
+		if (random() % 2) numbers = std::string("[") + alphabet[random() % (sizeof(alphabet) - 1)] + "]";
+		size_t length = random() % 34;
+		for (size_t j = 0; j < length; ++j) numbers += alphabet[random() % (sizeof(alphabet) - 1)];
+		inputs.push_back(numbers);
+	}
+
+	std::vector<BatchResult> results(inputs.size());
+	AddBatch(inputs.data(), inputs.size(), results.data());
+	int wrong = 0;
+	for (size_t i = 0; i < inputs.size(); ++i) {
+		BatchResult expected = AddScalar(inputs[i]);
+		if (results[i].ok != expected.ok || results[i].value != expected.value) ++wrong;
+	}
+	BOOST_CHECK(wrong == 0);
+	BOOST_CHECK(results[5].ok && results[5].value == 30);
+	BOOST_CHECK(!results[7].ok && results[7].value == -1);
+
+	int16_t delim;
+	BOOST_CHECK(LaneBody("1,2", delim) == 0 && delim == -1);
+	BOOST_CHECK(LaneBody("[;]3;4", delim) == 3 && delim == ';');
+	BOOST_CHECK(LaneBody("[,,][..]1..2,,3", delim) == std::string::npos);
+	BOOST_CHECK(LaneBody("[;][,]1", delim) == std::string::npos);
+	BOOST_CHECK(LaneBody(std::string(LaneBytes, '1'), delim) == std::string::npos);
+}
\ No newline at end of file
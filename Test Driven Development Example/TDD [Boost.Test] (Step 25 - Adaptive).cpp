@@ -0,0 +1,564 @@
+#define BOOST_TEST_MODULE AddStringTest
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <thread>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#include "boost\test\unit_test.hpp"
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//25.
+//Pick the fastest way to add each input. Take a cheap look at it (length, header size, how many delimiters and how long) and send it
+//to the engine that suits it best, with the crossover points measured on this machine and kept in a small profile file
+// - Added the engines: EngineScalar is Add(), EngineSimd finds runs of digits 16 bytes at a time, EngineThreads splits a long input
+//	 without delimiters between threads and EngineAutomaton looks up delimiters by their first byte
+// - Added InspectInput(), ChooseEngine() and AdaptiveCalculator, whose Add() reports the engine it picked to a debug hook
+// - Added Calibrate() which times the engines to find the crossover points, and SaveProfile()/LoadProfile() to keep them
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TDD_SSE2
+#include <emmintrin.h>
+#endif
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+struct DelimSpec {
+	bool usingDelim = false;	//false means any non digit splits numbers
+	std::vector<std::string> delimiters;
+	size_t bodyStart = 0;	//offset of the first character after the delimiter declarations
+};
+
+DelimSpec ParseDelimSpec(const char* numbers, size_t size) {	//reads the delimiters the same way as the top of Add()
+	DelimSpec spec;
+	if (size == 0 || isdigit(numbers[0])) return spec;
+
+	spec.usingDelim = true;
+	spec.delimiters.push_back("");
+	size_t i = 0;
+	for (; i < size; ++i) {
+		if (numbers[i] == '[') continue;
+		if (numbers[i] == ']') {
+			if ((i + 1) < size && numbers[i + 1] != '[') {
+				++i;
+				break;
+			}
+			spec.delimiters.push_back("");
+			continue;
+		}
+		spec.delimiters[spec.delimiters.size() - 1] += numbers[i];
+	}
+	spec.bodyStart = i;
+	return spec;
+}
+
+DelimSpec ParseDelimSpec(const std::string& numbers) {
+	return ParseDelimSpec(numbers.data(), numbers.size());
+}
+
+int ParseTokenValue(const char* first, const char* last) {	//same result as reading an int from a stringstream, without the copy
+	while (first != last && (*first == ' ' || (*first >= '\t' && *first <= '\r'))) ++first;	//stringstream skips leading whitespace
+	bool negative = false;
+	if (first != last && (*first == '-' || *first == '+')) negative = *first++ == '-';
+	long long value = 0;
+	for (; first != last && *first >= '0' && *first <= '9'; ++first) {
+		value = value * 10 + (*first - '0');
+		if (value > 1LL + INT_MAX) value = 1LL + INT_MAX;	//out of range, stringstream gives back INT_MAX or INT_MIN
+	}
+	if (negative) return value > INT_MAX ? INT_MIN : int(-value);
+	return value > INT_MAX ? INT_MAX : int(value);
+}
+
+enum Engine { EngineScalar, EngineSimd, EngineThreads, EngineAutomaton };
+
+const char* EngineName(Engine engine) {
+	const char* names[] = { "scalar", "simd", "threads", "automaton" };
+	return names[engine];
+}
+
+unsigned LowestBit(unsigned mask) {	//mask can't be 0
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward(&index, mask);
+	return unsigned(index);
+#else
+	return unsigned(__builtin_ctz(mask));
+#endif
+}
+
+//Without delimiters every run of digits is a number, so this is Add() for input that starts with a digit
+long long SumDigitRuns(const char* data, size_t size) {
+	long long sum = 0;
+	int value = 0;	//kept at 1001 or less, which is all the over 1000 rule needs
+	bool inRun = false;
+	size_t i = 0;
+#ifdef TDD_SSE2
+	const __m128i zero = _mm_set1_epi8('0');
+	const __m128i nine = _mm_set1_epi8(9);
+	for (; i + 16 <= size; i += 16) {
+		__m128i digits = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), zero);
+		unsigned mask = unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(digits, nine), digits)));	//bytes '0' to '9'
+		unsigned j = 0;
+		while (j < 16) {
+			if (inRun) {
+				unsigned end = j + LowestBit(~mask >> j);	//first byte after the run, 16 if it carries on into the next block
+				for (; j < end && value <= 1000; ++j) value = value * 10 + (data[i + j] - '0');
+				value = std::min(value, 1001);
+				j = end;
+				if (end < 16) {
+					sum += value <= 1000 ? value : 0;
+					value = 0;
+					inRun = false;
+				}
+			}
+			else {
+				unsigned starts = mask >> j;
+				if (!starts) break;	//no more numbers in this block
+				j += LowestBit(starts);
+				inRun = true;
+			}
+		}
+	}
+#endif
+	for (; i < size; ++i) {
+		if (data[i] >= '0' && data[i] <= '9') {
+			if (value <= 1000) value = std::min(value * 10 + (data[i] - '0'), 1001);
+			inRun = true;
+		}
+		else if (inRun) {
+			sum += value <= 1000 ? value : 0;
+			value = 0;
+			inRun = false;
+		}
+	}
+	if (inRun && value <= 1000) sum += value;
+	return sum;
+}
+
+long long SumDigitRunsThreaded(const char* data, size_t size, unsigned threads) {
+	threads = std::max(1u, threads);
+	std::vector<size_t> bounds(1, 0);
+	for (unsigned t = 1; t < threads; ++t) {	//move each split forward past the digits so no number is cut in two
+		size_t at = std::max(bounds.back(), size * t / threads);
+		while (at < size && data[at] >= '0' && data[at] <= '9') ++at;
+		bounds.push_back(at);
+	}
+	bounds.push_back(size);
+
+	std::vector<long long> sums(threads);
+	std::vector<std::thread> workers;
+	for (unsigned t = 1; t < threads; ++t) workers.emplace_back([&, t]() { sums[t] = SumDigitRuns(data + bounds[t], bounds[t + 1] - bounds[t]); });
+	sums[0] = SumDigitRuns(data, bounds[1]);
+	for (std::thread& worker : workers) worker.join();
+	long long sum = 0;
+	for (long long part : sums) sum += part;
+	return sum;
+}
+
+class DelimAutomaton {	//the delimiters sorted by their first byte, so each position only tries the ones that can match
+public:
+	explicit DelimAutomaton(const DelimSpec& spec) :spec(spec) {
+		for (size_t d = 0; d < spec.delimiters.size(); ++d) {
+			if (spec.delimiters[d].size()) byFirst[uint8_t(spec.delimiters[d].front())].push_back(d);	//list order kept, the first match wins
+		}
+	}
+
+	long long Sum(const char* data, size_t size) const {	//same result as Add(), throws at the first negative
+		long long sum = 0;
+		size_t start = spec.bodyStart;
+		for (size_t i = spec.bodyStart; i < size;) {
+			size_t length = Match(data, size, i);
+			if (length == 0) {
+				++i;
+				continue;
+			}
+			sum += Value(data + start, data + i);
+			i += length;
+			start = i;
+		}
+		return sum + Value(data + start, data + size);
+	}
+
+private:
+	size_t Match(const char* data, size_t size, size_t i) const {
+		for (size_t d : byFirst[uint8_t(data[i])]) {
+			const std::string& delim = spec.delimiters[d];
+			if (size - i >= delim.size() && std::memcmp(data + i, delim.data(), delim.size()) == 0) return delim.size();
+		}
+		return 0;
+	}
+
+	static int Value(const char* first, const char* last) {
+		int value = ParseTokenValue(first, last);
+		if (value < 0) throw NegativeNumberException(value);
+		return value <= 1000 ? value : 0;
+	}
+
+	const DelimSpec& spec;
+	std::vector<size_t> byFirst[256];
+};
+
+struct InputShape {
+	size_t length = 0;
+	bool usingDelim = false;
+	size_t headerSize = 0;
+	size_t delimCount = 0;	//delimiters that aren't empty
+	size_t longestDelim = 0;
+};
+
+InputShape InspectInput(const std::string& numbers, DelimSpec& spec) {	//only reads the header
+	spec = ParseDelimSpec(numbers);
+	InputShape shape;
+	shape.length = numbers.size();
+	shape.usingDelim = spec.usingDelim;
+	shape.headerSize = spec.bodyStart;
+	for (const std::string& delim : spec.delimiters) {
+		if (delim.empty()) continue;
+		++shape.delimCount;
+		shape.longestDelim = std::max(shape.longestDelim, delim.size());
+	}
+	return shape;
+}
+
+struct EngineProfile {	//the crossover points, SIZE_MAX means never
+	size_t simdMinBytes = 64;
+	size_t threadMinBytes = 8 << 20;
+	size_t automatonMinBytes = 256;
+	size_t automatonMinDelims = 2;
+	unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+};
+
+Engine ChooseEngine(const InputShape& shape, const EngineProfile& profile) {
+	if (!shape.usingDelim) {
+		if (profile.threads > 1 && shape.length >= profile.threadMinBytes) return EngineThreads;
+		return shape.length >= profile.simdMinBytes ? EngineSimd : EngineScalar;
+	}
+	if (shape.length >= profile.automatonMinBytes || shape.delimCount >= profile.automatonMinDelims) return EngineAutomaton;
+	return EngineScalar;
+}
+
+int AddWith(Engine engine, const std::string& numbers, const DelimSpec& spec, unsigned threads) {	//spec is ParseDelimSpec(numbers)
+	if ((engine == EngineAutomaton) != spec.usingDelim) engine = EngineScalar;	//the engine can't read this input
+	switch (engine) {
+	case EngineSimd: return int(SumDigitRuns(numbers.data(), numbers.size()));
+	case EngineThreads: return int(SumDigitRunsThreaded(numbers.data(), numbers.size(), threads));
+	case EngineAutomaton: return int(DelimAutomaton(spec).Sum(numbers.data(), numbers.size()));
+	default: return Add(numbers);
+	}
+}
+
+class AdaptiveCalculator {
+public:
+	explicit AdaptiveCalculator(const EngineProfile& profile = EngineProfile()) :profile(profile) {}
+
+	void SetDebugHook(std::function<void(Engine, const InputShape&)> hook) { onChoice = hook; }	//told the engine for every Add()
+
+	int Add(const std::string& numbers) const {
+		DelimSpec spec;
+		InputShape shape = InspectInput(numbers, spec);
+		Engine engine = ChooseEngine(shape, profile);
+		if (onChoice) onChoice(engine, shape);
+		return AddWith(engine, numbers, spec, profile.threads);
+	}
+
+	const EngineProfile& Profile() const { return profile; }
+
+private:
+	EngineProfile profile;
+	std::function<void(Engine, const InputShape&)> onChoice;
+};
+
+double TimeEngine(Engine engine, const std::string& numbers, unsigned threads) {	//best of a few runs, in seconds
+	DelimSpec spec = ParseDelimSpec(numbers);
+	double best = 1e9;
+	volatile int sink = 0;
+	for (int run = 0; run < 5; ++run) {
+		auto start = std::chrono::steady_clock::now();
+		sink = sink + AddWith(engine, numbers, spec, threads);
+		best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+	}
+	return best;
+}
+
+std::string CalibrationInput(size_t bytes, size_t delimCount) {	//numbers up to 1200 split by delimCount delimiters taken in turn
+	std::string numbers;
+	std::vector<std::string> delims;
+	for (size_t d = 0; d < delimCount; ++d) delims.push_back(std::string(1, char('a' + d % 26)) + std::string(d / 26, '#'));
+	if (delimCount) {
+		for (const std::string& delim : delims) numbers += "[" + delim + "]";
+	}
+	for (size_t i = 0; numbers.size() < bytes; ++i) {
+		numbers += std::to_string(i * 37 % 1200);
+		numbers += delimCount ? delims[i % delimCount] : ",";
+	}
+	return numbers;
+}
+
+//Times the engines against Add() on made up input, doubling the size until the faster engine wins or maxBytes is reached
+EngineProfile Calibrate(size_t maxBytes = 32 << 20) {
+	EngineProfile profile;
+	profile.simdMinBytes = profile.threadMinBytes = profile.automatonMinBytes = profile.automatonMinDelims = SIZE_MAX;
+
+	for (size_t bytes = 16; bytes <= maxBytes && profile.simdMinBytes == SIZE_MAX; bytes *= 2) {
+		std::string numbers = CalibrationInput(bytes, 0);
+		if (TimeEngine(EngineSimd, numbers, 1) < TimeEngine(EngineScalar, numbers, 1)) profile.simdMinBytes = bytes;
+	}
+	for (size_t bytes = 1 << 16; profile.threads > 1 && bytes <= maxBytes && profile.threadMinBytes == SIZE_MAX; bytes *= 2) {
+		std::string numbers = CalibrationInput(bytes, 0);
+		if (TimeEngine(EngineThreads, numbers, profile.threads) < TimeEngine(EngineSimd, numbers, 1)) profile.threadMinBytes = bytes;
+	}
+	for (size_t bytes = 16; bytes <= maxBytes && profile.automatonMinBytes == SIZE_MAX; bytes *= 2) {
+		std::string numbers = CalibrationInput(bytes, 1);
+		if (TimeEngine(EngineAutomaton, numbers, 1) < TimeEngine(EngineScalar, numbers, 1)) profile.automatonMinBytes = bytes;
+	}
+	for (size_t delims = 1; delims <= 64 && profile.automatonMinDelims == SIZE_MAX; delims *= 2) {	//short input, so the header is a big part of it
+		std::string numbers = CalibrationInput(std::min<size_t>(maxBytes, 64) + delims * 4, delims);
+		if (TimeEngine(EngineAutomaton, numbers, 1) < TimeEngine(EngineScalar, numbers, 1)) profile.automatonMinDelims = delims;
+	}
+	return profile;
+}
+
+const char* ProfileHeader = "stringcalc-profile 1";
+
+void SaveProfile(const std::string& path, const EngineProfile& profile) {
+	std::ofstream out(path);
+	out << ProfileHeader << '\n';
+	out << "simdMinBytes " << profile.simdMinBytes << '\n';
+	out << "threadMinBytes " << profile.threadMinBytes << '\n';
+	out << "automatonMinBytes " << profile.automatonMinBytes << '\n';
+	out << "automatonMinDelims " << profile.automatonMinDelims << '\n';
+	out << "threads " << profile.threads << '\n';
+	if (!out) throw std::runtime_error("can't write " + path);
+}
+
+bool LoadProfile(const std::string& path, EngineProfile& profile) {	//false if the file is missing or not a profile, profile is left as it was
+	std::ifstream in(path);
+	std::string line;
+	if (!std::getline(in, line) || line != ProfileHeader) return false;
+
+	EngineProfile loaded = profile;
+	std::string key;
+	unsigned long long value;
+	while (in >> key >> value) {
+		if (key == "simdMinBytes") loaded.simdMinBytes = size_t(value);
+		else if (key == "threadMinBytes") loaded.threadMinBytes = size_t(value);
+		else if (key == "automatonMinBytes") loaded.automatonMinBytes = size_t(value);
+		else if (key == "automatonMinDelims") loaded.automatonMinDelims = size_t(value);
+		else if (key == "threads") loaded.threads = unsigned(std::max(1ULL, std::min<unsigned long long>(value, 1024)));
+	}	//keys from a newer version are skipped
+	if (!in.eof()) return false;
+	profile = loaded;
+	return true;
+}
+
+BOOST_AUTO_TEST_CASE(test25) {
+	std::vector<std::string> inputs = { "1 2 3", "", "1001,1000", "99999999999999,1", "[,,][..]1..2,,3", "[\nn][...]1\nn1001|\nn1\n1 ,.(\nn1...1\n", "[;]23;/4;;7",
+		"[\n]3\n9\n-1", "[-]1-2", "[;]", "[][;]1;2", "[ab][a][b]1ab2a3b4", "[;] 7; +8;-0;+-1" };
+	std::mt19937 random(25);
+	const char alphabet[] = "0123456789;,- x";
+	for (int i = 0; i < 2000; ++i) {
+		std::string numbers = i % 3 ? "" : "[;][,-][x]";
+		size_t length = random() % 100;
+		for (size_t j = 0; j < length; ++j) numbers += alphabet[random() % (sizeof(alphabet) - 1)];
+		inputs.push_back(numbers);
+	}
+	std::string big;
+	for (int i = 0; i < 300000; ++i) big += std::to_string(i % 1300) + (i % 5 ? "," : "  ");
+	inputs.push_back(big);
+	inputs.push_back(CalibrationInput(100000, 40));
+
+	for (const std::string& numbers : inputs) {
+		DelimSpec spec = ParseDelimSpec(numbers);
+		for (Engine engine : { EngineScalar, EngineSimd, EngineThreads, EngineAutomaton }) {
+			try {
+				int expected = Add(numbers);
+				BOOST_CHECK(AddWith(engine, numbers, spec, 3) == expected);
+			}
+			catch (NegativeNumberException& e) {
+				try {
+					AddWith(engine, numbers, spec, 3);
+					BOOST_ERROR("no exception from " << EngineName(engine));
+				}
+				catch (NegativeNumberException& other) {
+					BOOST_CHECK(std::string(e.what()) == other.what());
+				}
+			}
+		}
+	}
+
+	EngineProfile profile;
+	profile.simdMinBytes = 100;
+	profile.threadMinBytes = 1000;
+	profile.automatonMinBytes = 50;
+	profile.automatonMinDelims = 3;
+	profile.threads = 4;
+	AdaptiveCalculator calc(profile);
+	std::vector<Engine> chosen;
+	calc.SetDebugHook([&](Engine engine, const InputShape&) { chosen.push_back(engine); });
+	calc.Add("1,2");
+	calc.Add(std::string(200, '1'));
+	calc.Add(big);
+	calc.Add("[;]1;2");
+	calc.Add("[;][,][x]1;2");
+	calc.Add("[;]" + std::string(60, '1'));
+	BOOST_CHECK((chosen == std::vector<Engine>{ EngineScalar, EngineSimd, EngineThreads, EngineScalar, EngineAutomaton, EngineAutomaton }));
+
+	DelimSpec spec;
+	InputShape shape = InspectInput("[,,][..][]1..2", spec);
+	BOOST_CHECK(shape.usingDelim && shape.headerSize == 10 && shape.delimCount == 2 && shape.longestDelim == 2);
+
+	SaveProfile("test25.profile", profile);
+	EngineProfile loaded;
+	BOOST_CHECK(LoadProfile("test25.profile", loaded));
+	BOOST_CHECK(loaded.simdMinBytes == 100 && loaded.threadMinBytes == 1000 && loaded.automatonMinBytes == 50 && loaded.automatonMinDelims == 3 && loaded.threads == 4);
+	std::ofstream("test25.profile") << "stringcalc-profile 1\nsimdMinBytes lots\n";
+	BOOST_CHECK(!LoadProfile("test25.profile", loaded) && loaded.simdMinBytes == 100);
+	BOOST_CHECK(!LoadProfile("test25_missing.profile", loaded));
+	std::remove("test25.profile");
+
+	EngineProfile measured = Calibrate(1 << 16);
+	BOOST_CHECK(measured.simdMinBytes > 0 && measured.automatonMinDelims > 0);
+}
\ No newline at end of file
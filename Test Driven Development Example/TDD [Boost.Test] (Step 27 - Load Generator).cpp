@@ -0,0 +1,381 @@
+#define BOOST_TEST_MODULE AddStringTest
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include "boost\test\unit_test.hpp"
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//27.
+//Measure tail latency the way real traffic sees it. Send requests in process at a fixed rate from chosen inputs across N threads,
+//time each one from when it was meant to start rather than when it did, and report p99 against throughput up to saturation
+// - Added LatencyHistogram, buckets 1/64 of a power of two wide so a percentile is within 2% of the real value
+// - Added RunLoad(), which calls a LoadTarget (Add(), a batch call, anything) on a fixed schedule. A late request isn't skipped or
+//	 pushed back, it keeps its place in the schedule so time spent waiting behind slow requests is counted (coordinated omission)
+// - Added SweepLoad(), which raises the rate until the target can't keep up, and PrintCurve()
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+class LatencyHistogram {	//nanoseconds
+public:
+	void Record(long long value) {
+		if (value < 0) value = 0;
+		++counts[Index(value)];
+		++count;
+		total += value;
+		maximum = std::max(maximum, value);
+	}
+
+	void Merge(const LatencyHistogram& other) {
+		for (size_t i = 0; i < counts.size(); ++i) counts[i] += other.counts[i];
+		count += other.count;
+		total += other.total;
+		maximum = std::max(maximum, other.maximum);
+	}
+
+	long long Percentile(double percent) const {	//the top of the bucket holding it, so it never reads low
+		long long wanted = (long long)(percent / 100.0 * count + 0.5);
+		long long seen = 0;
+		for (size_t i = 0; i < counts.size(); ++i) {
+			seen += counts[i];
+			if (seen >= std::max(wanted, 1LL)) return std::min(Upper(i), maximum);
+		}
+		return maximum;
+	}
+
+	long long Count() const { return count; }
+	long long Max() const { return maximum; }
+	double Mean() const { return count ? double(total) / count : 0; }
+
+private:
+	static const int SubBuckets = 64;
+
+	static size_t Index(long long value) {	//values under 128 have a bucket each, above that 64 buckets per power of two
+		int shift = 0;
+		while ((value >> shift) >= 2 * SubBuckets) ++shift;
+		return size_t(shift) * SubBuckets + size_t(value >> shift);
+	}
+
+	static long long Upper(size_t index) {
+		int shift = std::max(0, int(index / SubBuckets) - 1);
+		long long mantissa = (long long)(index - size_t(shift) * SubBuckets);
+		return ((mantissa + 1) << shift) - 1;
+	}
+
+	std::vector<long long> counts = std::vector<long long>(SubBuckets * 59);
+	long long count = 0;
+	long long total = 0;
+	long long maximum = 0;
+};
+
+typedef std::function<void(const std::string* const* inputs, size_t count)> LoadTarget;	//one operation, batchSize inputs
+
+LoadTarget AddTarget() {	//Add() on each input, negatives are a normal answer
+	return [](const std::string* const* inputs, size_t count) {
+		for (size_t i = 0; i < count; ++i) {
+			try {
+				Add(*inputs[i]);
+			}
+			catch (NegativeNumberException&) {
+			}
+		}
+	};
+}
+
+struct LoadInputs {	//inputs and how often each is picked
+	std::vector<std::string> inputs;
+	std::vector<double> weights;	//empty means all the same
+
+	void Add(const std::string& numbers, double weight = 1) {
+		inputs.push_back(numbers);
+		weights.push_back(weight);
+	}
+};
+
+struct LoadOptions {
+	double rate = 1000;	//operations per second, across all threads
+	unsigned threads = 1;
+	std::chrono::milliseconds duration = std::chrono::milliseconds(1000);
+	size_t batchSize = 1;	//inputs per operation
+	unsigned seed = 1;
+};
+
+struct LoadResult {
+	double targetRate = 0;
+	double achievedRate = 0;	//operations finished per second, from the start until the last one finished
+	LatencyHistogram latency;	//from when each operation was meant to start until it finished
+	LatencyHistogram service;	//from when it really started, what a closed loop benchmark would report
+};
+
+LoadResult RunLoad(const LoadTarget& target, const LoadInputs& inputs, const LoadOptions& options) {
+	typedef std::chrono::steady_clock Clock;
+	unsigned threads = std::max(1u, options.threads);
+	size_t batchSize = std::max<size_t>(1, options.batchSize);
+	double perThread = options.rate / threads;
+	long long operations = (long long)(perThread * std::chrono::duration<double>(options.duration).count());
+	std::chrono::nanoseconds interval((long long)(1e9 / std::max(perThread, 1e-9)));
+
+	if (inputs.inputs.empty()) throw std::invalid_argument("RunLoad needs at least one input");
+	if (!inputs.weights.empty() && inputs.weights.size() != inputs.inputs.size()) throw std::invalid_argument("RunLoad needs a weight for every input");
+	std::vector<std::vector<size_t>> picks(threads);	//indices into inputs.inputs, picked before the clock starts so choosing isn't timed
+	for (unsigned t = 0; t < threads; ++t) {
+		std::mt19937 random(options.seed + t);
+		std::discrete_distribution<size_t> pick(inputs.weights.begin(), inputs.weights.end());
+		if (inputs.weights.empty()) pick = std::discrete_distribution<size_t>(inputs.inputs.size(), 0, 1, [](double) { return 1.0; });
+		picks[t].resize(size_t(operations) * batchSize);
+		for (size_t& index : picks[t]) index = pick(random);
+	}
+
+	std::vector<LoadResult> results(threads);
+	std::vector<Clock::time_point> finished(threads);
+	Clock::time_point start = Clock::now() + std::chrono::milliseconds(10);
+	std::vector<std::thread> workers;
+	for (unsigned t = 0; t < threads; ++t) workers.emplace_back([&, t]() {
+		Clock::time_point first = start + interval * t / threads;	//threads take turns so the arrivals are evenly spread
+		std::vector<const std::string*> batch(batchSize);
+		for (long long i = 0; i < operations; ++i) {
+			for (size_t j = 0; j < batchSize; ++j) batch[j] = &inputs.inputs[picks[t][size_t(i) * batchSize + j]];	//before the wait, so it isn't timed
+			Clock::time_point intended = first + interval * i;
+			if (Clock::now() < intended - std::chrono::microseconds(200)) std::this_thread::sleep_until(intended - std::chrono::microseconds(100));
+			while (Clock::now() < intended) {}	//sleeping isn't precise enough for the last bit
+			Clock::time_point began = Clock::now();
+			target(batch.data(), batchSize);
+			Clock::time_point done = Clock::now();
+			results[t].latency.Record(std::chrono::duration_cast<std::chrono::nanoseconds>(done - intended).count());
+			results[t].service.Record(std::chrono::duration_cast<std::chrono::nanoseconds>(done - began).count());
+		}
+		finished[t] = Clock::now();
+	});
+	for (std::thread& worker : workers) worker.join();
+
+	LoadResult result;
+	result.targetRate = options.rate;
+	for (unsigned t = 0; t < threads; ++t) {
+		result.latency.Merge(results[t].latency);
+		result.service.Merge(results[t].service);
+	}
+	double seconds = std::chrono::duration<double>(*std::max_element(finished.begin(), finished.end()) - start).count();
+	result.achievedRate = seconds > 0 ? result.latency.Count() / seconds : 0;
+	return result;
+}
+
+//Runs at rates from options.rate upwards, multiplying by step, and stops after the first rate the target can't keep up with
+//(achieved under 90% of the target) or maxRuns
+std::vector<LoadResult> SweepLoad(const LoadTarget& target, const LoadInputs& inputs, LoadOptions options, double step = 2, int maxRuns = 20) {
+	std::vector<LoadResult> curve;
+	for (int run = 0; run < maxRuns; ++run) {
+		curve.push_back(RunLoad(target, inputs, options));
+		if (curve.back().achievedRate < 0.9 * options.rate) break;	//saturated
+		options.rate *= step;
+	}
+	return curve;
+}
+
+void PrintCurve(std::ostream& out, const std::vector<LoadResult>& curve) {	//microseconds
+	out << std::setw(12) << "target/s" << std::setw(12) << "achieved/s" << std::setw(10) << "p50" << std::setw(10) << "p99" << std::setw(10) << "p99.9"
+		<< std::setw(10) << "max" << std::setw(14) << "service p99" << '\n';
+	for (const LoadResult& point : curve) {
+		out << std::fixed << std::setprecision(0) << std::setw(12) << point.targetRate << std::setw(12) << point.achievedRate << std::setprecision(1)
+			<< std::setw(10) << point.latency.Percentile(50) / 1e3 << std::setw(10) << point.latency.Percentile(99) / 1e3
+			<< std::setw(10) << point.latency.Percentile(99.9) / 1e3 << std::setw(10) << point.latency.Max() / 1e3
+			<< std::setw(14) << point.service.Percentile(99) / 1e3 << '\n';
+	}
+}
+
+BOOST_AUTO_TEST_CASE(test27) {
+	LatencyHistogram histogram;
+	for (long long i = 1; i <= 100000; ++i) histogram.Record(i * 1000);
+	BOOST_CHECK(histogram.Count() == 100000 && histogram.Max() == 100000000);
+	for (double percent : { 50.0, 90.0, 99.0, 99.9 }) {
+		double exact = percent * 1e6;
+		BOOST_CHECK(histogram.Percentile(percent) >= exact && histogram.Percentile(percent) <= exact * 1.02);
+	}
+	BOOST_CHECK(histogram.Percentile(100) == 100000000);
+	LatencyHistogram small;
+	for (long long i = 0; i < 100; ++i) small.Record(i);
+	BOOST_CHECK(small.Percentile(50) == 49);	//exact below 128
+	small.Merge(histogram);
+	BOOST_CHECK(small.Count() == 100100 && small.Max() == 100000000);
+
+	LoadInputs inputs;
+	inputs.Add("1,2");
+	inputs.Add("[;]23;/4;;7");
+	inputs.Add("[;]1;-2");
+	LoadOptions options;
+	options.rate = 2000;
+	options.threads = 2;
+	options.duration = std::chrono::milliseconds(200);
+	std::atomic<long long> calls(0);
+	LoadResult light = RunLoad([&](const std::string* const* numbers, size_t count) { AddTarget()(numbers, count); calls += count; }, inputs, options);
+	BOOST_CHECK(light.latency.Count() == 400 && light.service.Count() == 400 && calls == 400);
+	BOOST_CHECK(light.achievedRate > 0 && light.latency.Max() >= light.service.Max());	//how fast depends on the machine, so no rate is checked
+
+	//each operation takes 2ms but they arrive every 1ms, so the queue grows. A closed loop would only see the 2ms
+	options.rate = 1000;
+	options.threads = 1;
+	options.batchSize = 3;
+	LoadResult overloaded = RunLoad([](const std::string* const*, size_t count) {
+		BOOST_CHECK(count == 3);
+		auto until = std::chrono::steady_clock::now() + std::chrono::milliseconds(2);
+		while (std::chrono::steady_clock::now() < until) {}
+	}, inputs, options);
+	BOOST_CHECK(overloaded.latency.Count() == 200 && overloaded.service.Percentile(50) >= 2000000);
+	BOOST_CHECK(overloaded.latency.Percentile(99) >= 100000000);	//the last ones wait behind at least 100 others, 200 * 2ms against 200 * 1ms
+	BOOST_CHECK(overloaded.achievedRate <= 500);	//no more than one every 2ms
+
+	std::vector<LoadResult> curve = SweepLoad([](const std::string* const*, size_t) {
+		auto until = std::chrono::steady_clock::now() + std::chrono::microseconds(500);
+		while (std::chrono::steady_clock::now() < until) {}
+	}, inputs, options, 2, 10);
+	BOOST_CHECK(!curve.empty() && curve.size() <= 10);
+	for (size_t i = 0; i + 1 < curve.size(); ++i) {	//every rate but the last kept up, the last didn't or was the tenth
+		BOOST_CHECK(curve[i].achievedRate >= 0.9 * curve[i].targetRate);
+		BOOST_CHECK(curve[i + 1].targetRate == curve[i].targetRate * 2);
+	}
+	BOOST_CHECK(curve.size() == 10 || curve.back().achievedRate < 0.9 * curve.back().targetRate);
+	BOOST_CHECK(curve.back().targetRate <= 1000 * 512 && curve.back().achievedRate <= 2000);	//500us each on one thread
+
+	BOOST_CHECK_THROW(RunLoad(AddTarget(), LoadInputs(), options), std::invalid_argument);
+	inputs.weights.pop_back();
+	BOOST_CHECK_THROW(RunLoad(AddTarget(), inputs, options), std::invalid_argument);
+}
\ No newline at end of file
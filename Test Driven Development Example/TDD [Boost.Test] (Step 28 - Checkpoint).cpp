@@ -0,0 +1,476 @@
+#define BOOST_TEST_MODULE AddStringTest
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+#include "boost\test\unit_test.hpp"
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//28.
+//Let a long streamed sum carry on after a crash instead of starting again. Write the scan's state (byte offset, delimiters, the
+//number and any delimiter cut off at the end of the last piece, the sum and the negatives so far) to a small file now and then, so
+//a restarted job can seek to the offset and finish with the same result as a run that never stopped
+// - Added StreamCheckpoint, SaveCheckpoint() which writes a temporary file and renames it over the old one so a crash while saving
+//	 leaves the last good checkpoint, and LoadCheckpoint() which checks the version and a checksum
+// - Added SumStreamResumable(), which carries on from the checkpoint file if there is one. Negatives are collected, not thrown
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :number(number), msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+
+	int number;	//the negative that was passed
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+struct StreamState {	//everything a streamed scan needs to carry on with the next piece
+	int stage = 0;	//0 nothing read yet, 1 reading delimiters, 2 reading numbers
+	bool usingDelim = false;
+	std::vector<std::string> delimiters;
+	size_t maxDelim = 1;
+	std::string pending;	//bytes we can't decide on until more arrive
+	std::string substring;	//the number being read
+	unsigned long long offset = 0;	//stream offset of pending.front()
+	unsigned long long tokenStart = 0;	//stream offset of substring.front()
+};
+
+//Reads the next piece of the stream, calling onToken(substring, offset) for every number that is known to have ended.
+//final means nothing else is coming, so nothing is held back
+template <typename F>
+void StreamFeed(StreamState& state, const char* data, size_t size, F onToken, bool final = false) {
+	std::string& pending = state.pending;
+	pending.append(data, size);
+	size_t i = 0;
+
+	if (state.stage == 0 && pending.size()) {	//the first character decides if there are delimiters, like the top of Add()
+		state.usingDelim = !isdigit(pending.front());
+		state.stage = state.usingDelim ? 1 : 2;
+		if (state.usingDelim) state.delimiters.assign(1, "");
+	}
+
+	while (state.stage == 1 && i < pending.size()) {
+		if (pending[i] == '[') {
+			++i;
+			continue;
+		}
+		if (pending[i] == ']') {
+			if ((i + 1) >= pending.size() && !final) break;	//need the next character to know if another delim follows
+			if ((i + 1) < pending.size() && pending[i + 1] != '[') {
+				state.stage = 2;
+				for (const std::string& delim : state.delimiters) state.maxDelim = std::max(state.maxDelim, delim.size());
+			}
+			else state.delimiters.push_back("");
+			++i;
+			continue;
+		}
+		state.delimiters[state.delimiters.size() - 1] += pending[i++];
+	}
+
+	while (state.stage == 2 && i < pending.size()) {
+		size_t delimLength = 0;
+		if (!state.usingDelim) delimLength = isdigit(pending[i]) ? 0 : 1;
+		else {
+			if (pending.size() - i < state.maxDelim && !final) break;	//a delim might start here and end in the next piece
+			for (const std::string& delim : state.delimiters) {
+				if (delim.size() && pending[i] == delim.front() && pending.compare(i, delim.size(), delim) == 0) {
+					delimLength = delim.size();
+					break;
+				}
+			}
+		}
+
+		if (delimLength) {
+			if (state.substring != "") {
+				onToken(state.substring, state.tokenStart);
+				state.substring = "";
+			}
+			i += delimLength;
+		}
+		else {
+			if (state.substring == "") state.tokenStart = state.offset + i;
+			state.substring += pending[i++];
+		}
+	}
+
+	pending.erase(0, i);
+	state.offset += i;
+}
+
+template <typename F>
+void StreamFinish(StreamState& state, F onToken) {	//end of the stream, hands out whatever was held back
+	StreamFeed(state, nullptr, 0, onToken, true);
+	if (state.substring != "") {
+		onToken(state.substring, state.tokenStart);
+		state.substring = "";
+	}
+}
+
+struct StreamCheckpoint {
+	StreamState state;
+	long long sum = 0;
+	std::vector<int> negatives;	//in the order they were found
+
+	unsigned long long Offset() const { return state.offset + state.pending.size(); }	//bytes of the stream read so far
+};
+
+const uint32_t CheckpointVersion = 1;
+
+class CheckpointWriter {	//little endian whatever the machine is
+public:
+	void Put(unsigned long long value, int bytes) {
+		for (int i = 0; i < bytes; ++i) data += char((value >> (8 * i)) & 0xFF);
+	}
+	void Put(const std::string& text) {
+		Put(text.size(), 8);
+		data += text;
+	}
+	std::string data;
+};
+
+class CheckpointReader {
+public:
+	explicit CheckpointReader(const std::string& data) :data(data) {}
+
+	unsigned long long Get(int bytes) {
+		Need(size_t(bytes));
+		unsigned long long value = 0;
+		for (int i = 0; i < bytes; ++i) value |= (unsigned long long)(uint8_t(data[used++])) << (8 * i);
+		return value;
+	}
+	std::string GetString() {
+		unsigned long long length = Get(8);
+		Need(length);
+		std::string text = data.substr(used, size_t(length));
+		used += size_t(length);
+		return text;
+	}
+	bool AtEnd() const { return used == data.size(); }
+
+private:
+	void Need(unsigned long long bytes) const {
+		if (data.size() - used < bytes) throw std::runtime_error("checkpoint is cut short");
+	}
+
+	const std::string& data;
+	size_t used = 0;
+};
+
+unsigned long long CheckpointHash(const std::string& data) {	//FNV-1a
+	unsigned long long hash = 14695981039346656037ULL;
+	for (char c : data) hash = (hash ^ uint8_t(c)) * 1099511628211ULL;
+	return hash;
+}
+
+void SaveCheckpoint(const std::string& path, const StreamCheckpoint& checkpoint) {
+	const StreamState& state = checkpoint.state;
+	CheckpointWriter out;
+	out.data = "SCCK";
+	out.Put(CheckpointVersion, 4);
+	out.Put((unsigned long long)state.stage, 1);
+	out.Put(state.usingDelim, 1);
+	out.Put(state.maxDelim, 8);
+	out.Put(state.offset, 8);
+	out.Put(state.tokenStart, 8);
+	out.Put((unsigned long long)checkpoint.sum, 8);
+	out.Put(state.delimiters.size(), 8);
+	for (const std::string& delim : state.delimiters) out.Put(delim);
+	out.Put(state.pending);
+	out.Put(state.substring);
+	out.Put(checkpoint.negatives.size(), 8);
+	for (int negative : checkpoint.negatives) out.Put((unsigned long long)(uint32_t)negative, 4);
+	out.Put(CheckpointHash(out.data), 8);
+
+	std::string temporary = path + ".tmp";
+	FILE* file = std::fopen(temporary.c_str(), "wb");
+	if (!file) throw std::runtime_error("can't write " + temporary);
+	bool written = std::fwrite(out.data.data(), 1, out.data.size(), file) == out.data.size() && std::fflush(file) == 0;
+#ifndef _WIN32
+	written = written && fsync(fileno(file)) == 0;	//on disk before it replaces the old one
+#endif
+	written = std::fclose(file) == 0 && written;
+#ifdef _WIN32
+	if (written) std::remove(path.c_str());	//rename won't replace a file on windows
+#endif
+	if (!written || std::rename(temporary.c_str(), path.c_str()) != 0) {
+		std::remove(temporary.c_str());
+		throw std::runtime_error("can't write " + path);
+	}
+}
+
+bool LoadCheckpoint(const std::string& path, StreamCheckpoint& checkpoint) {	//false if there is no checkpoint, throws if it is damaged
+	std::ifstream file(path, std::ios::binary);
+	if (!file) return false;
+	std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	if (data.size() < 16 || data.compare(0, 4, "SCCK") != 0) throw std::runtime_error(path + " isn't a checkpoint");
+	std::string body = data.substr(0, data.size() - 8);
+	if (CheckpointReader(data.substr(data.size() - 8)).Get(8) != CheckpointHash(body)) throw std::runtime_error(path + " is damaged");
+
+	CheckpointReader in(body);
+	in.Get(4);
+	if (in.Get(4) != CheckpointVersion) throw std::runtime_error(path + " is from another version");
+	StreamCheckpoint loaded;
+	StreamState& state = loaded.state;
+	state.stage = int(in.Get(1));
+	state.usingDelim = in.Get(1) != 0;
+	state.maxDelim = size_t(in.Get(8));
+	state.offset = in.Get(8);
+	state.tokenStart = in.Get(8);
+	loaded.sum = (long long)in.Get(8);
+	for (unsigned long long count = in.Get(8); count; --count) state.delimiters.push_back(in.GetString());
+	state.pending = in.GetString();
+	state.substring = in.GetString();
+	for (unsigned long long count = in.Get(8); count; --count) loaded.negatives.push_back(int(uint32_t(in.Get(4))));
+	if (!in.AtEnd() || state.stage < 0 || state.stage > 2) throw std::runtime_error(path + " is damaged");
+	checkpoint = loaded;
+	return true;
+}
+
+struct CheckpointOptions {
+	std::string path;	//the checkpoint file
+	unsigned long long every = 64 << 20;	//bytes read between checkpoints
+	size_t chunkSize = 1 << 20;
+	std::function<void(const StreamCheckpoint&)> onCheckpoint;	//called after each one is saved
+};
+
+//Adds up the stream, carrying on from options.path if a checkpoint is there. in has to be the same stream from its start, it is
+//moved to the checkpoint's offset. The checkpoint file is removed once the stream is finished
+StreamCheckpoint SumStreamResumable(std::istream& in, const CheckpointOptions& options) {
+	StreamCheckpoint checkpoint;
+	if (LoadCheckpoint(options.path, checkpoint) && checkpoint.Offset()) {
+		in.seekg(std::streamoff(checkpoint.Offset()));
+		if (!in) {	//not seekable, read up to it instead
+			in.clear();
+			for (unsigned long long skip = checkpoint.Offset(); skip && in.ignore(std::streamsize(std::min<unsigned long long>(skip, 1 << 30))); skip -= (unsigned long long)in.gcount());
+		}
+	}
+
+	auto onToken = [&checkpoint](const std::string& substring, unsigned long long) {
+		try {
+			checkpoint.sum += StringToNumber<int>(substring);
+		}
+		catch (NegativeNumberException& e) {
+			checkpoint.negatives.push_back(e.number);
+		}
+	};
+	std::vector<char> chunk(std::max<size_t>(options.chunkSize, 1));
+	unsigned long long lastSaved = checkpoint.Offset();
+	while (in.read(chunk.data(), std::streamsize(chunk.size())) || in.gcount()) {
+		StreamFeed(checkpoint.state, chunk.data(), size_t(in.gcount()), onToken);
+		if (checkpoint.Offset() - lastSaved >= options.every) {
+			SaveCheckpoint(options.path, checkpoint);
+			lastSaved = checkpoint.Offset();
+			if (options.onCheckpoint) options.onCheckpoint(checkpoint);
+		}
+	}
+	StreamFinish(checkpoint.state, onToken);
+	std::remove(options.path.c_str());
+	return checkpoint;
+}
+
+StreamCheckpoint SumUninterrupted(const std::string& numbers) {
+	CheckpointOptions options;
+	options.path = "test28_clean.checkpoint";
+	std::istringstream in(numbers);
+	return SumStreamResumable(in, options);
+}
+
+BOOST_AUTO_TEST_CASE(test28) {
+	std::vector<std::string> inputs = { "1 2 3", "", "[,,][..]1..2,,3", "[\nn][...]1\nn1001|\nn1\n1 ,.(\nn1...1\n", "[;]23;/4;;7", "[\n]3\n9\n-1\n4\n-2" };
+	std::string big = "[;;][;,][,]";	//delimiters that share a start, so pieces end part way through one
+	for (int i = 0; i < 20000; ++i) big += std::to_string(i % 1300) + (i % 3 == 0 ? ";;" : i % 3 == 1 ? ";," : ",") + (i % 997 == 0 ? "-" + std::to_string(i) + "," : "");
+	inputs.push_back(big);
+
+	for (const std::string& numbers : inputs) {
+		StreamCheckpoint expected = SumUninterrupted(numbers);
+		try {
+			BOOST_CHECK(expected.sum == Add(numbers) && expected.negatives.empty());
+		}
+		catch (NegativeNumberException& e) {
+			BOOST_CHECK(expected.negatives.size() && expected.negatives.front() == e.number);
+		}
+
+		for (unsigned long long every : { 1, 7, 1000 }) {	//crash after each checkpoint in turn, then resume
+			CheckpointOptions options;
+			options.path = "test28.checkpoint";
+			options.every = every;
+			options.chunkSize = 5;
+			int crashAt = 1;
+			for (bool finished = false; !finished; ++crashAt) {
+				int saved = 0;
+				options.onCheckpoint = [&](const StreamCheckpoint&) {
+					if (++saved == crashAt) throw std::logic_error("crash");
+				};
+				std::istringstream in(numbers);
+				try {
+					StreamCheckpoint result = SumStreamResumable(in, options);
+					BOOST_CHECK(result.sum == expected.sum && result.negatives == expected.negatives);
+					finished = true;
+				}
+				catch (std::logic_error&) {
+				}
+				if (crashAt > 50) options.every = 1 << 30;	//big input, just finish it
+			}
+			std::ifstream left(options.path);
+			BOOST_CHECK(!left);
+		}
+	}
+
+	StreamCheckpoint checkpoint;
+	BOOST_CHECK(!LoadCheckpoint("test28_missing.checkpoint", checkpoint));
+	checkpoint.sum = 1234;
+	checkpoint.negatives = { -5, INT_MIN };
+	StreamFeed(checkpoint.state, "[**][*]12**3", 12, [](const std::string&, unsigned long long) {});
+	SaveCheckpoint("test28.checkpoint", checkpoint);
+	StreamCheckpoint loaded;
+	BOOST_CHECK(LoadCheckpoint("test28.checkpoint", loaded));
+	BOOST_CHECK(loaded.sum == 1234 && loaded.negatives == checkpoint.negatives && loaded.Offset() == 12);
+	BOOST_CHECK(loaded.state.delimiters == checkpoint.state.delimiters && loaded.state.pending == checkpoint.state.pending && loaded.state.substring == checkpoint.state.substring);
+
+	std::string data;
+	{
+		std::ifstream file("test28.checkpoint", std::ios::binary);
+		data.assign((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	}
+	data[20] ^= 1;
+	std::ofstream("test28.checkpoint", std::ios::binary) << data;
+	BOOST_CHECK_THROW(LoadCheckpoint("test28.checkpoint", loaded), std::runtime_error);
+	std::remove("test28.checkpoint");
+}
\ No newline at end of file
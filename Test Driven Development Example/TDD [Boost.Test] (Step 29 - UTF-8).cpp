@@ -0,0 +1,398 @@
+#define BOOST_TEST_MODULE AddStringTest
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include "boost\test\unit_test.hpp"
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//29.
+//Handle UTF-8 properly. Delimiters like the em dash in requirement 7 are matched as whole characters, the input is checked to be
+//valid UTF-8 in the same pass that reads the numbers, and 16 bytes at a time are skipped when none of them are above 127
+// - Added Utf8Validator, which checks a buffer up to wherever it is asked and throws InvalidUtf8Exception at the first bad byte
+//	 (overlong forms, surrogates, past U+10FFFF, cut short or stray continuation bytes)
+// - Added AddUtf8(), the same result as Add() for valid UTF-8. Digits are checked with c >= '0' && c <= '9' as isdigit() is undefined
+//	 for the negative chars non ASCII bytes become
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TDD_SSE2
+#include <emmintrin.h>
+#endif
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+struct InvalidUtf8Exception : public std::exception {
+	InvalidUtf8Exception(size_t offset) :offset(offset), msg("Invalid UTF-8 at byte " + std::to_string(offset)) {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+
+	size_t offset;	//of the first byte that can't be there
+private:
+	std::string msg;
+};
+
+bool IsDigit(char c) {	//isdigit() on a char above 127 is undefined
+	return c >= '0' && c <= '9';
+}
+
+bool IsAsciiBlock(const char* data) {	//16 bytes none of which have the top bit set
+#ifdef TDD_SSE2
+	return _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data))) == 0;
+#else
+	uint64_t words[2];
+	std::memcpy(words, data, 16);
+	return ((words[0] | words[1]) & 0x8080808080808080ULL) == 0;
+#endif
+}
+
+class Utf8Validator {	//checks a buffer from the front, as far as it is asked each time
+public:
+	Utf8Validator(const char* data, size_t size) :data(data), size(size) {}
+
+	void CheckTo(size_t end) {	//throws at the first bad byte before end
+		while (checked < end) {
+			if (remaining == 0 && size - checked >= 16 && IsAsciiBlock(data + checked)) {	//between characters, so plain ASCII can be skipped
+				checked += 16;
+				continue;
+			}
+			uint8_t byte = uint8_t(data[checked]);
+			if (remaining) {
+				if (byte < low || byte > high) throw InvalidUtf8Exception(checked);
+				--remaining;
+				low = 0x80;
+				high = 0xBF;
+			}
+			else if (byte >= 0x80) Start(byte);
+			++checked;
+		}
+	}
+
+	void Finish() {	//the whole buffer, which can't end part way through a character
+		CheckTo(size);
+		if (remaining) throw InvalidUtf8Exception(size);
+	}
+
+private:
+	void Start(uint8_t byte) {	//the first byte of a character says how many follow and what the next one can be
+		low = 0x80;
+		high = 0xBF;
+		if (byte >= 0xC2 && byte <= 0xDF) remaining = 1;
+		else if (byte >= 0xE0 && byte <= 0xEF) {
+			remaining = 2;
+			if (byte == 0xE0) low = 0xA0;	//overlong
+			if (byte == 0xED) high = 0x9F;	//surrogates
+		}
+		else if (byte >= 0xF0 && byte <= 0xF4) {
+			remaining = 3;
+			if (byte == 0xF0) low = 0x90;	//overlong
+			if (byte == 0xF4) high = 0x8F;	//past U+10FFFF
+		}
+		else throw InvalidUtf8Exception(checked);	//a continuation byte on its own, C0, C1 or F5 and up
+	}
+
+	const char* data;
+	size_t size;
+	size_t checked = 0;
+	int remaining = 0;	//continuation bytes still to come
+	uint8_t low = 0x80, high = 0xBF;	//range of the next continuation byte
+};
+
+struct DelimSpec {
+	bool usingDelim = false;	//false means any non digit splits numbers
+	std::vector<std::string> delimiters;
+	size_t bodyStart = 0;	//offset of the first character after the delimiter declarations
+};
+
+DelimSpec ParseDelimSpec(const char* numbers, size_t size) {	//reads the delimiters the same way as the top of Add()
+	DelimSpec spec;
+	if (size == 0 || IsDigit(numbers[0])) return spec;
+
+	spec.usingDelim = true;
+	spec.delimiters.push_back("");
+	size_t i = 0;
+	for (; i < size; ++i) {
+		if (numbers[i] == '[') continue;
+		if (numbers[i] == ']') {
+			if ((i + 1) < size && numbers[i + 1] != '[') {
+				++i;
+				break;
+			}
+			spec.delimiters.push_back("");
+			continue;
+		}
+		spec.delimiters[spec.delimiters.size() - 1] += numbers[i];
+	}
+	spec.bodyStart = i;
+	return spec;
+}
+
+DelimSpec ParseDelimSpec(const std::string& numbers) {
+	return ParseDelimSpec(numbers.data(), numbers.size());
+}
+
+int ParseTokenValue(const char* first, const char* last) {	//same result as reading an int from a stringstream, without the copy
+	while (first != last && (*first == ' ' || (*first >= '\t' && *first <= '\r'))) ++first;	//stringstream skips leading whitespace
+	bool negative = false;
+	if (first != last && (*first == '-' || *first == '+')) negative = *first++ == '-';
+	long long value = 0;
+	for (; first != last && *first >= '0' && *first <= '9'; ++first) {
+		value = value * 10 + (*first - '0');
+		if (value > 1LL + INT_MAX) value = 1LL + INT_MAX;	//out of range, stringstream gives back INT_MAX or INT_MIN
+	}
+	if (negative) return value > INT_MAX ? INT_MIN : int(-value);
+	return value > INT_MAX ? INT_MAX : int(value);
+}
+
+//Same result as Add() for valid UTF-8, and throws InvalidUtf8Exception otherwise. A delimiter is a whole number of characters, so
+//in valid UTF-8 it can only match where a character starts and matching the bytes matches the characters
+int AddUtf8(const char* data, size_t size) {
+	Utf8Validator validator(data, size);
+	DelimSpec spec = ParseDelimSpec(data, size);
+	validator.CheckTo(spec.bodyStart);
+
+	int sum = 0;
+	size_t start = spec.bodyStart;	//where the current number began
+	auto flush = [&](size_t end) {
+		int value = ParseTokenValue(data + start, data + end);
+		if (value < 0) throw NegativeNumberException(value);
+		if (value <= 1000) sum += value;
+	};
+	for (size_t i = spec.bodyStart; i < size;) {
+		size_t length = 0;
+		if (!spec.usingDelim) length = IsDigit(data[i]) ? 0 : 1;
+		else {
+			for (const std::string& delim : spec.delimiters) {
+				if (delim.size() && size - i >= delim.size() && std::memcmp(data + i, delim.data(), delim.size()) == 0) {
+					length = delim.size();
+					break;
+				}
+			}
+		}
+		validator.CheckTo(i + std::max<size_t>(length, 1));	//each byte is checked as the scan reaches it
+		if (length) {
+			flush(i);
+			i += length;
+			start = i;
+		}
+		else ++i;
+	}
+	validator.Finish();
+	flush(size);
+	return sum;
+}
+
+int AddUtf8(const std::string& numbers) {
+	return AddUtf8(numbers.data(), numbers.size());
+}
+
+BOOST_AUTO_TEST_CASE(test29) {
+	const std::string dash = "\xE2\x80\x94", dot = "\xC2\xB7", clef = "\xF0\x9D\x84\x9E";
+	std::string big = "[" + dash + "]";	//non ASCII at every alignment between long ASCII runs
+	int bigSum = 0;
+	for (int i = 0; i < 3000; ++i) {
+		big += std::to_string(i % 1100) + (i % 5 ? dash : std::string(i % 17, 'x') + dash);
+		if (i % 1100 <= 1000) bigSum += i % 1100;
+	}
+	//Add() passes bytes above 127 to isdigit(), which is undefined, so it's only the reference for ASCII inputs
+	std::vector<std::pair<std::string, int>> utf8 = {
+		{ "[" + dash + "]1" + dash + "2" + dash + "3", 6 },
+		{ "[" + dash + "][" + dot + "]10" + dot + "20" + dash + "5", 35 },
+		{ "[" + clef + "]7" + clef + "8" + dash + "9", 15 },	//the dash isn't a delimiter, so 8 ends where the number stops
+		{ "1" + dash + "2" + dot + "3" + clef, 6 },	//without delimiters every byte that isn't a digit splits
+		{ "[\xE2\x80\x94\xE2\x80\x94][" + dash + "]1" + dash + dash + dash + "2", 3 },
+		{ big, bigSum } };
+	for (const std::pair<std::string, int>& input : utf8) BOOST_CHECK(AddUtf8(input.first) == input.second);
+	try {
+		AddUtf8("[" + dash + "]" + dash + dash + "4" + dash + "-6");
+		BOOST_ERROR("no exception");
+	}
+	catch (NegativeNumberException& e) {
+		BOOST_CHECK(std::string(e.what()) == "Negative numbers not allowed! (-6)");
+	}
+
+	const char* ascii[] = { "1 2 3", "", "[,,][..]1..2,,3", "[;]23;/4;;7", "[;]5;-3;-4", "12,1001,x7" };
+	for (const char* numbers : ascii) {
+		try {
+			int sum = Add(numbers);
+			BOOST_CHECK(AddUtf8(numbers) == sum);
+		}
+		catch (NegativeNumberException& e) {
+			try {
+				AddUtf8(numbers);
+				BOOST_ERROR("no exception");
+			}
+			catch (NegativeNumberException& other) {
+				BOOST_CHECK(std::string(e.what()) == other.what());
+			}
+		}
+	}
+
+	std::vector<std::pair<std::string, size_t>> invalid = {
+		{ "1,\x80", 2 },	//continuation on its own
+		{ "1,\xC0\xAF", 2 },	//overlong /
+		{ "1,\xC1\xBF", 2 },
+		{ "1,\xE0\x80\xAF", 3 },	//overlong three bytes
+		{ "1,\xED\xA0\x80", 3 },	//surrogate
+		{ "1,\xF0\x80\x80\xAF", 3 },
+		{ "1,\xF4\x90\x80\x80", 3 },	//past U+10FFFF
+		{ "1,\xF5\x80\x80\x80", 2 },
+		{ "1,\xFF", 2 },
+		{ "1,\xE2\x80", 4 },	//cut short at the end
+		{ "[;]1;\xE2\x80;3", 7 },
+		{ "[\xE2\x80]1", 3 },	//in the header
+		{ std::string(40, '1') + "\xC3" + std::string(40, '1'), 41 },	//inside the ASCII blocks
+	};
+	for (const auto& test : invalid) {
+		try {
+			AddUtf8(test.first);
+			BOOST_ERROR("accepted " << test.first);
+		}
+		catch (InvalidUtf8Exception& e) {
+			BOOST_CHECK_MESSAGE(e.offset == test.second, test.first << " at " << e.offset);
+		}
+	}
+
+	const char* valid[] = { "\x7F", "\xC2\x80", "\xDF\xBF", "\xE0\xA0\x80", "\xED\x9F\xBF", "\xEE\x80\x80", "\xEF\xBF\xBF", "\xF0\x90\x80\x80", "\xF4\x8F\xBF\xBF" };
+	for (const char* character : valid) {
+		Utf8Validator validator(character, std::strlen(character));
+		BOOST_CHECK_NO_THROW(validator.Finish());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,526 @@
+#define BOOST_TEST_MODULE AddStringTest
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <random>
+#include <locale>
+#include <thread>
+#include "boost\test\unit_test.hpp"
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//30.
+//Add up decimal values such as prices. Add<double>() and Add<Decimal<N>>() keep the negative and over 1000 rules, read numbers
+//without a stringstream in the common case, and add them so the same values always give the same total however the work is split
+// - Without delimiters a '.' is part of a number, and so is an exponent after digits (1.5e-3). Numbers may have a fraction and
+//	 an exponent (1.5, .25, 2e2)
+// - Added ParseDecimal(), which reads the digits into an integer and a power of ten. Up to 2^53 with a power of ten from -22 to 22
+//	 the double is exact from one multiply or divide (Clinger's fast path), anything else goes to the stringstream
+// - Added Decimal<N>, a count of 10^-N units so sums are exact. Digits past N are rounded half up
+// - Added SumReproducible(), which gives each fixed block of 4096 values its own compensated (Neumaier) sum in two lanes, then adds
+//	 the blocks in order. The blocks don't depend on the number of threads so neither does the total
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TDD_SSE2
+#include <emmintrin.h>
+#endif
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+	NegativeNumberException(const std::string& number) :msg("Negative numbers not allowed! (" + number + ")") {}	//a decimal as it was written
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+struct DelimSpec {
+	bool usingDelim = false;	//false means any non digit splits numbers
+	std::vector<std::string> delimiters;
+	size_t bodyStart = 0;	//offset of the first character after the delimiter declarations
+};
+
+DelimSpec ParseDelimSpec(const char* numbers, size_t size) {	//reads the delimiters the same way as the top of Add()
+	DelimSpec spec;
+	if (size == 0 || isdigit(numbers[0])) return spec;
+
+	spec.usingDelim = true;
+	spec.delimiters.push_back("");
+	size_t i = 0;
+	for (; i < size; ++i) {
+		if (numbers[i] == '[') continue;
+		if (numbers[i] == ']') {
+			if ((i + 1) < size && numbers[i + 1] != '[') {
+				++i;
+				break;
+			}
+			spec.delimiters.push_back("");
+			continue;
+		}
+		spec.delimiters[spec.delimiters.size() - 1] += numbers[i];
+	}
+	spec.bodyStart = i;
+	return spec;
+}
+
+DelimSpec ParseDelimSpec(const std::string& numbers) {
+	return ParseDelimSpec(numbers.data(), numbers.size());
+}
+
+bool IsDigit(char c) {
+	return c >= '0' && c <= '9';
+}
+
+struct DecimalText {	//a number as read from the input, value = mantissa * 10^exponent
+	bool negative = false;
+	uint64_t mantissa = 0;	//the first 19 significant digits
+	int exponent = 0;
+	bool truncated = false;	//there were more digits than fit
+	const char* first = nullptr;	//the number without the whitespace in front, for the slow path and messages
+	const char* last = nullptr;
+};
+
+//Reads like a stringstream would: whitespace, a sign, digits with an optional '.', an optional exponent, then stops at anything else.
+//Without any digits the value is 0
+DecimalText ParseDecimal(const char* first, const char* last) {
+	DecimalText text;
+	while (first != last && (*first == ' ' || (*first >= '\t' && *first <= '\r'))) ++first;
+	text.first = first;
+	if (first != last && (*first == '-' || *first == '+')) text.negative = *first++ == '-';
+
+	int digits = 0;	//significant digits kept in mantissa
+	bool seenDigit = false, seenPoint = false;
+	for (; first != last && (IsDigit(*first) || (*first == '.' && !seenPoint)); ++first) {
+		if (*first == '.') {
+			seenPoint = true;
+			continue;
+		}
+		seenDigit = true;
+		if (text.mantissa == 0 && *first == '0') {	//leading zeros don't use up digits
+			if (seenPoint) --text.exponent;
+			continue;
+		}
+		if (digits < 19) {
+			text.mantissa = text.mantissa * 10 + uint64_t(*first - '0');
+			++digits;
+			if (seenPoint) --text.exponent;
+		}
+		else {
+			text.truncated = text.truncated || *first != '0';
+			if (!seenPoint) ++text.exponent;
+		}
+	}
+	if (!seenDigit) {
+		text.negative = false;
+		text.mantissa = 0;
+		text.exponent = 0;
+		text.last = first;
+		return text;
+	}
+
+	if (first != last && (*first == 'e' || *first == 'E')) {	//only counts if digits follow
+		const char* at = first + 1;
+		bool negativeExponent = false;
+		if (at != last && (*at == '-' || *at == '+')) negativeExponent = *at++ == '-';
+		if (at != last && IsDigit(*at)) {
+			int exponent = 0;
+			for (; at != last && IsDigit(*at); ++at) exponent = std::min(exponent * 10 + (*at - '0'), 100000);
+			text.exponent += negativeExponent ? -exponent : exponent;
+			first = at;
+		}
+	}
+	text.last = first;
+	return text;
+}
+
+double ToDouble(const DecimalText& text) {
+	static const double powers[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+	double value;
+	if (!text.truncated && text.mantissa <= (1ULL << 53) && text.exponent >= -22 && text.exponent <= 22) {	//both exact, so one rounding
+		value = double(text.mantissa);
+		value = text.exponent < 0 ? value / powers[-text.exponent] : value * powers[text.exponent];
+	}
+	else if (text.mantissa == 0) value = 0;
+	else {
+		std::istringstream in(std::string(text.first, text.last));	//the rare case, the standard library rounds it correctly
+		in.imbue(std::locale::classic());
+		in >> value;
+		if (!in && value == 0) value = std::copysign(text.exponent > 0 ? HUGE_VAL : 0.0, text.negative ? -1.0 : 1.0);	//keeps the sign of an underflow
+		return value;
+	}
+	return text.negative ? -value : value;
+}
+
+template <int Scale>
+struct Decimal {	//Scale digits after the point, kept as a whole number of 10^-Scale units so adding is exact
+	long long units = 0;
+
+	Decimal& operator+=(const Decimal& other) {
+		units += other.units;
+		return *this;
+	}
+	bool operator==(const Decimal& other) const { return units == other.units; }
+
+	double ToDouble() const { return double(units) / std::pow(10.0, Scale); }
+
+	std::string ToString() const {
+		std::string digits = std::to_string(units < 0 ? -units : units);
+		if (Scale == 0) return (units < 0 ? "-" : "") + digits;
+		if (digits.size() <= size_t(Scale)) digits.insert(0, size_t(Scale) + 1 - digits.size(), '0');
+		digits.insert(digits.size() - Scale, 1, '.');
+		return (units < 0 ? "-" : "") + digits;
+	}
+};
+
+template <int Scale>
+std::ostream& operator<<(std::ostream& out, const Decimal<Scale>& value) {
+	return out << value.ToString();
+}
+
+uint64_t PowerOfTen(int power) {	//power from 0 to 19
+	uint64_t value = 1;
+	while (power-- > 0) value *= 10;
+	return value;
+}
+
+//The Add() rules for one number, negatives throw and anything over 1000 counts as 0. A negative is any number with a '-' and a
+//digit that isn't 0, even one too small for the type, so both types throw for the same text
+double ConvertToken(const DecimalText& text, double*) {
+	if (text.negative && text.mantissa) throw NegativeNumberException(std::string(text.first, text.last));
+	double value = ToDouble(text);
+	return value > 1000 ? 0 : value;
+}
+
+template <int Scale>
+Decimal<Scale> ConvertToken(const DecimalText& text, Decimal<Scale>*) {
+	if (text.negative && text.mantissa) throw NegativeNumberException(std::string(text.first, text.last));
+	const uint64_t limit = 1000 * PowerOfTen(Scale);	//1000 in units
+	Decimal<Scale> value;
+	int shift = text.exponent + Scale;	//units = mantissa * 10^shift
+	if (shift >= 0) {
+		if (shift > 19 || text.mantissa > limit / PowerOfTen(shift)) return value;	//over 1000, or close to it and checked below
+		uint64_t units = text.mantissa * PowerOfTen(shift);
+		if (units > limit || (units == limit && text.truncated)) return value;
+		value.units = (long long)units;
+	}
+	else if (shift >= -19) {
+		uint64_t divisor = PowerOfTen(-shift);
+		uint64_t units = text.mantissa / divisor, rest = text.mantissa % divisor;
+		if (units > limit || (units == limit && (rest || text.truncated))) return value;	//over 1000 before rounding
+		value.units = (long long)(units + (rest >= divisor - divisor / 2 ? 1 : 0));	//half up
+	}
+	return value;	//too small to reach one unit
+}
+
+//Calls onToken(value) for each number, the same split into numbers as Add() except a '.' and an exponent after a digit don't end
+//a number without delimiters
+template <typename T, typename F>
+void ForEachDecimal(const std::string& numbers, F onToken) {
+	DelimSpec spec = ParseDelimSpec(numbers);
+	const char* data = numbers.data();
+	size_t size = numbers.size(), start = spec.bodyStart;
+	bool seenDigit = false, seenExponent = false;	//in the number being read
+	for (size_t i = spec.bodyStart; i < size;) {
+		size_t length = 0;
+		if (!spec.usingDelim) {
+			length = (IsDigit(data[i]) || data[i] == '.') ? 0 : 1;
+			seenDigit = seenDigit || IsDigit(data[i]);
+			if (length && seenDigit && !seenExponent && (data[i] == 'e' || data[i] == 'E')) {
+				size_t digit = i + 1;	//e, an optional sign and a digit, the same as ParseDecimal() accepts
+				if (digit < size && (data[digit] == '-' || data[digit] == '+')) ++digit;
+				if (digit < size && IsDigit(data[digit])) {
+					seenExponent = true;
+					i = digit;
+					continue;
+				}
+			}
+		}
+		else {
+			for (const std::string& delim : spec.delimiters) {
+				if (delim.size() && size - i >= delim.size() && std::memcmp(data + i, delim.data(), delim.size()) == 0) {
+					length = delim.size();
+					break;
+				}
+			}
+		}
+		if (length) {
+			onToken(ConvertToken(ParseDecimal(data + start, data + i), static_cast<T*>(nullptr)));
+			i += length;
+			start = i;
+			seenDigit = seenExponent = false;
+		}
+		else ++i;
+	}
+	onToken(ConvertToken(ParseDecimal(data + start, data + size), static_cast<T*>(nullptr)));
+}
+
+const size_t SumBlock = 4096;
+
+struct CompensatedSum {	//Neumaier's version of Kahan summation, also right when a value is bigger than the sum so far
+	double sum = 0, compensation = 0;
+
+	void Add(double value) {
+		double total = sum + value;
+		if (std::fabs(sum) >= std::fabs(value)) compensation += (sum - total) + value;
+		else compensation += (value - total) + sum;
+		sum = total;
+	}
+	void Add(const CompensatedSum& other) {
+		Add(other.sum);
+		compensation += other.compensation;
+	}
+	double Result() const { return sum + compensation; }
+};
+
+CompensatedSum SumBlockValues(const double* values, size_t count) {	//values at even and odd positions in two lanes, then the lanes together
+	CompensatedSum lanes[2];
+	size_t i = 0;
+#ifdef TDD_SSE2
+	const __m128d signBit = _mm_set1_pd(-0.0);
+	__m128d sum = _mm_setzero_pd(), compensation = _mm_setzero_pd();
+	for (; i + 2 <= count; i += 2) {	//the same operations as CompensatedSum::Add() in each lane
+		__m128d value = _mm_loadu_pd(values + i);
+		__m128d total = _mm_add_pd(sum, value);
+		__m128d sumBigger = _mm_cmpge_pd(_mm_andnot_pd(signBit, sum), _mm_andnot_pd(signBit, value));
+		__m128d big = _mm_or_pd(_mm_and_pd(sumBigger, sum), _mm_andnot_pd(sumBigger, value));
+		__m128d small = _mm_or_pd(_mm_and_pd(sumBigger, value), _mm_andnot_pd(sumBigger, sum));
+		compensation = _mm_add_pd(compensation, _mm_add_pd(_mm_sub_pd(big, total), small));
+		sum = total;
+	}
+	double sums[2], compensations[2];
+	_mm_storeu_pd(sums, sum);
+	_mm_storeu_pd(compensations, compensation);
+	for (int lane = 0; lane < 2; ++lane) {
+		lanes[lane].sum = sums[lane];
+		lanes[lane].compensation = compensations[lane];
+	}
+#else
+	for (; i + 2 <= count; i += 2) {
+		lanes[0].Add(values[i]);
+		lanes[1].Add(values[i + 1]);
+	}
+#endif
+	if (i < count) lanes[0].Add(values[i]);
+	lanes[0].Add(lanes[1]);
+	return lanes[0];
+}
+
+//Compensated sum that comes out the same for any number of threads, as the blocks and the order they are joined never change
+double SumReproducible(const double* values, size_t count, unsigned threads = 1) {
+	size_t blocks = (count + SumBlock - 1) / SumBlock;
+	std::vector<CompensatedSum> partials(blocks);
+	threads = unsigned(std::max<size_t>(1, std::min<size_t>(threads, blocks)));
+	auto work = [&](unsigned t) {
+		for (size_t b = t; b < blocks; b += threads) partials[b] = SumBlockValues(values + b * SumBlock, std::min(SumBlock, count - b * SumBlock));
+	};
+	std::vector<std::thread> workers;
+	for (unsigned t = 1; t < threads; ++t) workers.emplace_back(work, t);
+	work(0);
+	for (std::thread& worker : workers) worker.join();
+
+	CompensatedSum total;
+	for (const CompensatedSum& partial : partials) total.Add(partial);
+	return total.Result();
+}
+
+template <typename T>
+T SumValues(const std::vector<T>& values) {	//decimals add up exactly
+	T total = T();
+	for (const T& value : values) total += value;
+	return total;
+}
+
+double SumValues(const std::vector<double>& values) {
+	return SumReproducible(values.data(), values.size());
+}
+
+//Add<double>("1.5,2.25") or Add<Decimal<2>>("[;]19.99;0.01"). Add("...") without a type is still the int version above
+template <typename T>
+T Add(const std::string& numbers) {
+	std::vector<T> values;
+	ForEachDecimal<T>(numbers, [&values](const T& value) { values.push_back(value); });
+	return SumValues(values);
+}
+
+BOOST_AUTO_TEST_CASE(test30) {
+	BOOST_CHECK(Add<double>("1.5,2.25") == 3.75);
+	BOOST_CHECK(Add<double>("") == 0);
+	BOOST_CHECK(Add<double>("1000,1000.0001,2e2") == 1000 + 200);	//without delimiters an exponent is part of the number
+	BOOST_CHECK(Add<double>("2e2") == 200 && Add<double>("1.5e-3") == 1.5e-3 && Add<double>("2E+1,1.e1") == 30);
+	BOOST_CHECK(Add<double>("2e2e2") == 202 && Add<double>("2e,3e-,4e+x") == 9 && Add<double>("1,e5,1e5") == 6);
+	for (const char* numbers : { "[,]1,-1e-400", "[,]1,-0.001", "[;]2;-1e-30", "[;]-0.0000000000000000000001" }) {	//both types agree on what is negative
+		BOOST_CHECK_THROW(Add<double>(numbers), NegativeNumberException);
+		BOOST_CHECK_THROW(Add<Decimal<2>>(numbers), NegativeNumberException);
+	}
+	BOOST_CHECK(Add<double>("[,]1,-0,-0.0e-400") == 1 && Add<Decimal<2>>("[,]1,-0,-0.0e-400").units == 100);
+	BOOST_CHECK(Add<double>("1,.e5") == 6 && Add<double>("1,.5e1") == 6 && Add<double>("1.e1") == 10);	//a lone '.' isn't a digit	//no digits after the e, or no number before it
+	BOOST_CHECK(Add<Decimal<3>>("1.5e-3,25e-1") == Add<Decimal<3>>("[,]0.0015,2.5"));
+	BOOST_CHECK(Add<double>("[;]23;/4;;7") == 30);
+	BOOST_CHECK(Add<double>("[;] .25;+.5;2.5e2;1e3;1.0005e3;3e;.;-0") == 3.75 + 250 + 1000);
+	BOOST_CHECK_THROW(Add<double>("[;]1;-0.5"), NegativeNumberException);
+	std::vector<std::string> ints = { "1 2 3", "[,,][..]1..2,,3", "[\nn][...]1\nn1001|\nn1\n1 ,.(\nn1...1\n", "[;]23;/4;;7" };
+	for (const std::string& numbers : ints) {	//inputs without a '.' give the same as the int version
+		if (numbers.find('.') == std::string::npos) BOOST_CHECK(Add<double>(numbers) == Add(numbers));
+		BOOST_CHECK(Add<Decimal<0>>(numbers).units == Add(numbers));
+	}
+
+	BOOST_CHECK(Add<Decimal<2>>("[;]19.99;0.01;5").ToString() == "25.00");
+	BOOST_CHECK(Add<Decimal<2>>("0.005,0.004").units == 1);	//half up
+	BOOST_CHECK(Add<Decimal<2>>("[;]999.995;1000.004;1000;0.5e-1").units == 100000 + 100000 + 5);	//999.995 rounds to 1000.00, 1000.004 is over 1000
+	BOOST_CHECK(Add<Decimal<3>>("[;]12345678901234567890123e-20").ToString() == "123.457");
+	BOOST_CHECK(Add<Decimal<2>>("[;]-0.00;1").units == 100);
+	BOOST_CHECK_THROW(Add<Decimal<2>>("[;]1;-0.001"), NegativeNumberException);
+	BOOST_CHECK(Decimal<2>{ -5 }.ToString() == "-0.05");
+
+	std::mt19937_64 random(30);	//the fast path and the fallback give the same bits as the standard library
+	for (int i = 0; i < 100000; ++i) {
+		std::string text = std::to_string(random() % 100000000000ULL);
+		if (i % 2) text.insert(random() % text.size(), ".");
+		if (i % 3 == 0) text += "e" + std::to_string(int(random() % 60) - 30);
+		if (i % 7 == 0) text = std::to_string(random()) + std::to_string(random()) + "." + std::to_string(random());
+		double expected = std::strtod(text.c_str(), nullptr);
+		BOOST_CHECK_MESSAGE(ToDouble(ParseDecimal(text.data(), text.data() + text.size())) == expected, text);
+	}
+
+	std::vector<double> values;
+	for (int i = 0; i < 100003; ++i) values.push_back(double(random() % 100000) / 100 + (i % 10 == 0 ? 1e9 : 0));
+	double one = SumReproducible(values.data(), values.size(), 1);
+	for (unsigned threads : { 2, 3, 8 }) BOOST_CHECK(SumReproducible(values.data(), values.size(), threads) == one);
+	long double exact = 0;
+	for (double value : values) exact += value;
+	BOOST_CHECK(std::fabs(double(exact) - one) <= std::fabs(one) * 1e-16);
+	std::vector<double> cancelling = { 1e16, 1, -1e16, 1 };
+	BOOST_CHECK(SumReproducible(cancelling.data(), cancelling.size()) == 2);
+}
\ No newline at end of file
@@ -0,0 +1,611 @@
+#define BOOST_TEST_MODULE AddStringTest
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iterator>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include "boost\test\unit_test.hpp"
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//33.
+//Record some of the real inputs and time any version of Add() on them later. Calls through an entry point are sampled into a trace file,
+//optionally with the digits scrambled, and a replay runs the trace and reports the speed, the latencies and any answer that differs from Add()
+// - Added TraceWriter and ReadTrace(). A trace is "TDDTRACE", a version, then each input after its 4 byte length
+// - Added Capture, which wraps an entry point and writes about sampleRate of the calls it sees
+// - Added ScrambleDigits(). Each number keeps its length, leading zeros and sign, and stays over or under 1000. Digits used in a delimiter
+//	 are never written so the input splits in the same places
+// - Added Replay(), which checks every answer against Add() and records each call in a LatencyHistogram from step 27
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :number(number), msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+
+	int number;	//the negative that was passed
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+
+struct DelimSpec {
+	bool usingDelim = false;	//false means any non digit splits numbers
+	std::vector<std::string> delimiters;
+	size_t bodyStart = 0;	//offset of the first character after the delimiter declarations
+};
+
+DelimSpec ParseDelimSpec(const char* numbers, size_t size) {	//reads the delimiters the same way as the top of Add()
+	DelimSpec spec;
+	if (size == 0 || isdigit(numbers[0])) return spec;
+
+	spec.usingDelim = true;
+	spec.delimiters.push_back("");
+	size_t i = 0;
+	for (; i < size; ++i) {
+		if (numbers[i] == '[') continue;
+		if (numbers[i] == ']') {
+			if ((i + 1) < size && numbers[i + 1] != '[') {
+				++i;
+				break;
+			}
+			spec.delimiters.push_back("");
+			continue;
+		}
+		spec.delimiters[spec.delimiters.size() - 1] += numbers[i];
+	}
+	spec.bodyStart = i;
+	return spec;
+}
+
+DelimSpec ParseDelimSpec(const std::string& numbers) {
+	return ParseDelimSpec(numbers.data(), numbers.size());
+}
+
+int ParseTokenValue(const char* first, const char* last) {	//same result as reading an int from a stringstream, without the copy
+	while (first != last && (*first == ' ' || (*first >= '\t' && *first <= '\r'))) ++first;	//stringstream skips leading whitespace
+	bool negative = false;
+	if (first != last && (*first == '-' || *first == '+')) negative = *first++ == '-';
+	long long value = 0;
+	for (; first != last && *first >= '0' && *first <= '9'; ++first) {
+		value = value * 10 + (*first - '0');
+		if (value > 1LL + INT_MAX) value = 1LL + INT_MAX;	//out of range, stringstream gives back INT_MAX or INT_MIN
+	}
+	if (negative) return value > INT_MAX ? INT_MIN : int(-value);
+	return value > INT_MAX ? INT_MAX : int(value);
+}
+
+void PutUint32(std::string& out, uint32_t value) {	//little endian whatever the machine is
+	for (int i = 0; i < 4; ++i) out += char((value >> (8 * i)) & 0xFF);
+}
+
+uint32_t GetUint32(const char* in) {
+	uint32_t value = 0;
+	for (int i = 0; i < 4; ++i) value |= uint32_t(uint8_t(in[i])) << (8 * i);
+	return value;
+}
+
+class LatencyHistogram {	//nanoseconds
+public:
+	void Record(long long value) {
+		if (value < 0) value = 0;
+		++counts[Index(value)];
+		++count;
+		total += value;
+		maximum = std::max(maximum, value);
+	}
+
+	void Merge(const LatencyHistogram& other) {
+		for (size_t i = 0; i < counts.size(); ++i) counts[i] += other.counts[i];
+		count += other.count;
+		total += other.total;
+		maximum = std::max(maximum, other.maximum);
+	}
+
+	long long Percentile(double percent) const {	//the top of the bucket holding it, so it never reads low
+		long long wanted = (long long)(percent / 100.0 * count + 0.5);
+		long long seen = 0;
+		for (size_t i = 0; i < counts.size(); ++i) {
+			seen += counts[i];
+			if (seen >= std::max(wanted, 1LL)) return std::min(Upper(i), maximum);
+		}
+		return maximum;
+	}
+
+	long long Count() const { return count; }
+	long long Max() const { return maximum; }
+	double Mean() const { return count ? double(total) / count : 0; }
+
+private:
+	static const int SubBuckets = 64;
+
+	static size_t Index(long long value) {	//values under 128 have a bucket each, above that 64 buckets per power of two
+		int shift = 0;
+		while ((value >> shift) >= 2 * SubBuckets) ++shift;
+		return size_t(shift) * SubBuckets + size_t(value >> shift);
+	}
+
+	static long long Upper(size_t index) {
+		int shift = std::max(0, int(index / SubBuckets) - 1);
+		long long mantissa = (long long)(index - size_t(shift) * SubBuckets);
+		return ((mantissa + 1) << shift) - 1;
+	}
+
+	std::vector<long long> counts = std::vector<long long>(SubBuckets * 59);
+	long long count = 0;
+	long long total = 0;
+	long long maximum = 0;
+};
+
+bool IsDigit(char c) {
+	return c >= '0' && c <= '9';
+}
+
+bool IsSpace(char c) {	//what a stringstream skips before a number
+	return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+uint64_t Mix(uint64_t value) {	//splitmix64, turns a counter into something that looks random
+	value += 0x9E3779B97F4A7C15ULL;
+	value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+	return value ^ (value >> 31);
+}
+
+const uint32_t TraceVersion = 1;
+
+class TraceWriter {	//safe to share between threads
+public:
+	explicit TraceWriter(const std::string& path) :file(std::fopen(path.c_str(), "wb")) {
+		if (!file) throw std::runtime_error("can't write " + path);
+		std::string header = "TDDTRACE";
+		PutUint32(header, TraceVersion);
+		std::fwrite(header.data(), 1, header.size(), file);
+	}
+
+	~TraceWriter() { std::fclose(file); }
+	TraceWriter(const TraceWriter&) = delete;
+	TraceWriter& operator=(const TraceWriter&) = delete;
+
+	void Write(const char* data, size_t size) {
+		std::string length;
+		PutUint32(length, uint32_t(std::min<size_t>(size, UINT32_MAX)));
+		std::lock_guard<std::mutex> hold(lock);
+		std::fwrite(length.data(), 1, 4, file);
+		std::fwrite(data, 1, std::min<size_t>(size, UINT32_MAX), file);
+		++count;
+	}
+
+	void Flush() {
+		std::lock_guard<std::mutex> hold(lock);
+		std::fflush(file);
+	}
+
+	size_t Count() {
+		std::lock_guard<std::mutex> hold(lock);
+		return count;
+	}
+
+private:
+	FILE* file;
+	std::mutex lock;
+	size_t count = 0;
+};
+
+//Throws if path isn't a trace. A last input that was cut short, as when the process writing it died, is left out
+std::vector<std::string> ReadTrace(const std::string& path) {
+	std::ifstream file(path, std::ios::binary);
+	if (!file) throw std::runtime_error("can't open " + path);
+	std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	if (data.size() < 12 || data.compare(0, 8, "TDDTRACE") != 0) throw std::runtime_error(path + " is not a trace");
+	if (GetUint32(&data[8]) != TraceVersion) throw std::runtime_error(path + " is from another version");
+	std::vector<std::string> inputs;
+	for (size_t at = 12; data.size() - at >= 4;) {
+		size_t length = GetUint32(&data[at]);
+		if (data.size() - at - 4 < length) break;
+		inputs.push_back(data.substr(at + 4, length));
+		at += 4 + length;
+	}
+	return inputs;
+}
+
+//Replaces the digits of each number so a trace can leave the building. The header, the delimiters and everything Add() doesn't read as
+//a number stay the same, so the trace still has the same shape and each number still counts, is capped or throws as it did
+std::string ScrambleDigits(const std::string& numbers, std::mt19937_64& random) {
+	DelimSpec spec = ParseDelimSpec(numbers);
+	bool inDelim[10] = {};
+	for (const std::string& delim : spec.delimiters) {
+		for (char c : delim) {
+			if (IsDigit(c)) inDelim[c - '0'] = true;
+		}
+	}
+	std::string digits, nonZero;	//a byte no delimiter has can't be part of a match, so writing only these can't make or break one
+	for (int d = 0; d < 10; ++d) {
+		if (!inDelim[d]) (d ? nonZero : digits) += char('0' + d);
+	}
+	digits += nonZero;
+
+	std::string out = numbers;
+	auto scramble = [&](size_t first, size_t last) {	//the number at the front of out[first, last), the part ParseTokenValue() reads
+		while (first < last && IsSpace(out[first])) ++first;
+		if (first < last && (out[first] == '-' || out[first] == '+')) ++first;
+		while (first < last && out[first] == '0') ++first;
+		size_t length = 0;
+		while (first + length < last && IsDigit(out[first + length])) ++length;
+		bool capped = length > 4 || (length == 4 && out.compare(first, 4, "1000") > 0);
+		if (length == 0 || nonZero.empty() || (length == 4 && !capped)) return;	//1000 is the only four digit number under the cap
+		for (int attempt = 0; attempt < 16; ++attempt) {
+			std::string scrambled(1, nonZero[random() % nonZero.size()]);
+			while (scrambled.size() < length) scrambled += digits[random() % digits.size()];
+			if (length == 4 && scrambled <= "1000") continue;
+			out.replace(first, length, scrambled);
+			return;
+		}
+	};
+
+	size_t start = spec.bodyStart;
+	for (size_t i = spec.bodyStart; i < out.size();) {
+		size_t length = 0;
+		if (!spec.usingDelim) length = IsDigit(out[i]) ? 0 : 1;
+		else {
+			for (const std::string& delim : spec.delimiters) {
+				if (delim.size() && out.compare(i, delim.size(), delim) == 0) {
+					length = delim.size();
+					break;
+				}
+			}
+		}
+		if (length) {
+			scramble(start, i);
+			i += length;
+			start = i;
+		}
+		else ++i;
+	}
+	scramble(start, out.size());
+	return out;
+}
+
+typedef std::function<int(const std::string&)> ReplayTarget;	//gives the sum or throws NegativeNumberException, like Add()
+
+struct CaptureOptions {
+	double sampleRate = 0.01;	//fraction of calls written to the trace
+	bool scramble = false;
+	uint64_t seed = 1;
+};
+
+class Capture {	//sits in front of an entry point, the calls it doesn't sample cost a counter and a hash
+public:
+	Capture(const std::string& path, const CaptureOptions& options = CaptureOptions()) :writer(path), options(options),
+		threshold(options.sampleRate >= 1 ? UINT64_MAX : uint64_t(std::max(options.sampleRate, 0.0) * 18446744073709551616.0)) {}
+
+	void Record(const std::string& numbers) {
+		uint64_t call = calls.fetch_add(1, std::memory_order_relaxed);
+		uint64_t draw = Mix(call ^ Mix(options.seed));
+		if (threshold != UINT64_MAX && draw >= threshold) return;
+		if (!options.scramble) {
+			writer.Write(numbers.data(), numbers.size());
+			return;
+		}
+		std::mt19937_64 random(draw);	//the same trace for the same seed and calls
+		std::string scrambled = ScrambleDigits(numbers, random);
+		writer.Write(scrambled.data(), scrambled.size());
+	}
+
+	ReplayTarget Wrap(ReplayTarget target) {	//target with every call offered to Record() first
+		return [this, target](const std::string& numbers) {
+			Record(numbers);
+			return target(numbers);
+		};
+	}
+
+	void Flush() { writer.Flush(); }
+	uint64_t Calls() const { return calls.load(); }
+	size_t Captured() { return writer.Count(); }
+
+private:
+	TraceWriter writer;
+	CaptureOptions options;
+	uint64_t threshold;
+	std::atomic<uint64_t> calls{ 0 };
+};
+
+struct ReplayOutcome {
+	bool negative = false;
+	int value = 0;	//the sum, or the negative that was thrown
+
+	bool operator==(const ReplayOutcome& other) const { return negative == other.negative && value == other.value; }
+	bool operator!=(const ReplayOutcome& other) const { return !(*this == other); }
+};
+
+ReplayOutcome RunTarget(const ReplayTarget& target, const std::string& numbers) {
+	ReplayOutcome outcome;
+	try {
+		outcome.value = target(numbers);
+	}
+	catch (NegativeNumberException& e) {
+		outcome.negative = true;
+		outcome.value = e.number;
+	}
+	return outcome;
+}
+
+struct ReplayMismatch {
+	size_t index = 0;	//in the trace
+	ReplayOutcome expected;	//from Add()
+	ReplayOutcome got;
+};
+
+struct ReplayOptions {
+	unsigned repeat = 1;	//times through the whole trace
+	size_t keepMismatches = 10;
+};
+
+struct ReplayResult {
+	size_t calls = 0;
+	size_t bytes = 0;
+	double seconds = 0;	//the calls alone, not the checking
+	LatencyHistogram latency;
+	size_t negatives = 0;	//calls where Add() throws
+	size_t mismatches = 0;
+	std::vector<ReplayMismatch> examples;	//the first keepMismatches of them, from the first time through
+
+	double CallsPerSecond() const { return seconds > 0 ? calls / seconds : 0; }
+	double BytesPerSecond() const { return seconds > 0 ? bytes / seconds : 0; }
+};
+
+//Runs the trace in order through target, the same calls every time, and checks each answer against Add()
+ReplayResult Replay(const std::vector<std::string>& trace, const ReplayTarget& target, const ReplayOptions& options = ReplayOptions()) {
+	typedef std::chrono::steady_clock Clock;
+	std::vector<ReplayOutcome> expected;
+	for (const std::string& numbers : trace) expected.push_back(RunTarget([](const std::string& input) { return Add(input); }, numbers));
+
+	ReplayResult result;
+	for (unsigned pass = 0; pass < options.repeat; ++pass) {
+		for (size_t i = 0; i < trace.size(); ++i) {
+			Clock::time_point start = Clock::now();
+			ReplayOutcome got = RunTarget(target, trace[i]);
+			long long elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+			result.latency.Record(elapsed);
+			result.seconds += elapsed / 1e9;
+			result.bytes += trace[i].size();
+			++result.calls;
+			if (expected[i].negative) ++result.negatives;
+			if (got != expected[i]) {
+				++result.mismatches;
+				if (pass == 0 && result.examples.size() < options.keepMismatches) result.examples.push_back({ i, expected[i], got });
+			}
+		}
+	}
+	return result;
+}
+
+void PrintReplay(std::ostream& out, const std::string& name, const ReplayResult& result) {	//microseconds
+	out << name << ": " << result.calls << " calls, " << std::fixed << std::setprecision(0) << result.CallsPerSecond() << "/s, "
+		<< std::setprecision(1) << result.BytesPerSecond() / 1e6 << " MB/s, p50 " << result.latency.Percentile(50) / 1e3 << " p99 "
+		<< result.latency.Percentile(99) / 1e3 << " max " << result.latency.Max() / 1e3 << ", " << result.mismatches << " mismatches\n";
+	for (const ReplayMismatch& mismatch : result.examples) {
+		out << "  #" << mismatch.index << " expected " << (mismatch.expected.negative ? "negative " : "") << mismatch.expected.value
+			<< " got " << (mismatch.got.negative ? "negative " : "") << mismatch.got.value << '\n';
+	}
+}
+
+std::vector<int> TokenClasses(const std::string& numbers) {	//-1 negative, 0 zero, 1 counted, 2 over 1000, for each number Add() reads
+	DelimSpec spec = ParseDelimSpec(numbers);
+	std::vector<int> classes;
+	auto classify = [&classes](const char* first, const char* last) {
+		int value = ParseTokenValue(first, last);
+		classes.push_back(value < 0 ? -1 : value == 0 ? 0 : value <= 1000 ? 1 : 2);
+	};
+	size_t start = spec.bodyStart;
+	for (size_t i = spec.bodyStart; i < numbers.size();) {
+		size_t length = 0;
+		if (!spec.usingDelim) length = IsDigit(numbers[i]) ? 0 : 1;
+		for (size_t d = 0; spec.usingDelim && d < spec.delimiters.size() && !length; ++d) {
+			const std::string& delim = spec.delimiters[d];
+			if (delim.size() && numbers.compare(i, delim.size(), delim) == 0) length = delim.size();
+		}
+		if (length) {
+			classify(numbers.data() + start, numbers.data() + i);
+			i += length;
+			start = i;
+		}
+		else ++i;
+	}
+	classify(numbers.data() + start, numbers.data() + numbers.size());
+	return classes;
+}
+
+BOOST_AUTO_TEST_CASE(test33) {
+	{
+		TraceWriter writer("test33.trace");
+		writer.Write("1,2", 3);
+		writer.Write("", 0);
+		writer.Write("[\n]3\n4", 6);
+	}
+	BOOST_CHECK(ReadTrace("test33.trace") == std::vector<std::string>({ "1,2", "", "[\n]3\n4" }));
+	std::ofstream("test33.trace", std::ios::binary | std::ios::app) << std::string("\x09\0\0\0" "1,2", 7);	//cut short by a crash
+	BOOST_CHECK(ReadTrace("test33.trace").size() == 3);
+	std::ofstream("test33.trace", std::ios::binary) << "TDDTRACX";
+	BOOST_CHECK_THROW(ReadTrace("test33.trace"), std::runtime_error);
+
+	std::mt19937_64 random(33);
+	const char characters[] = "0123456789-;, \n[]*1";
+	std::vector<std::string> headers = { "", "[;]", "[,][;]", "[1][;]", "[**][*]", "[\n]", "[0][9][5][;]", "[-]", "[ 2]" };
+	for (int i = 0; i < 20000; ++i) {
+		std::string input = headers[random() % headers.size()];
+		for (int length = random() % 24; length > 0; --length) input += characters[random() % (sizeof(characters) - 1)];
+		std::string scrambled = ScrambleDigits(input, random);
+		bool same = scrambled.size() == input.size();
+		for (size_t c = 0; same && c < input.size(); ++c) same = IsDigit(input[c]) == IsDigit(scrambled[c]) && (IsDigit(input[c]) || input[c] == scrambled[c]);
+		BOOST_CHECK_MESSAGE(same && TokenClasses(scrambled) == TokenClasses(input), input);
+	}
+	std::string kept = ScrambleDigits("[;]1000;007;-0", random);	//1000, the leading zeros and -0 stay
+	BOOST_CHECK(kept.substr(0, 10) == "[;]1000;00" && kept[10] >= '1' && kept[10] <= '9' && kept.substr(11) == ";-0");
+
+	CaptureOptions options;	//sampling
+	options.sampleRate = 0.25;
+	{
+		Capture capture("test33.trace", options);
+		ReplayTarget add = capture.Wrap([](const std::string& numbers) { return Add(numbers); });
+		for (int i = 0; i < 10000; ++i) BOOST_CHECK(add(std::to_string(i) + ",1") == (i <= 1000 ? i : 0) + 1);
+		BOOST_CHECK(capture.Calls() == 10000);
+		BOOST_CHECK(capture.Captured() > 2300 && capture.Captured() < 2700);
+	}
+	std::vector<std::string> trace = ReadTrace("test33.trace");
+	BOOST_CHECK(trace.size() > 2300 && trace.size() < 2700);
+	options.sampleRate = 1;
+	options.scramble = true;
+	{
+		Capture capture("test33.trace", options);
+		for (const char* numbers : { "[;]5;-3", "12,4000", "[;]1000;1001" }) capture.Record(numbers);
+	}
+	trace = ReadTrace("test33.trace");
+	BOOST_CHECK(trace.size() == 3 && trace[2] != "[;]1000;1001" && trace[2].substr(0, 8) == "[;]1000;");
+	std::remove("test33.trace");
+
+	ReplayOptions replayOptions;
+	replayOptions.repeat = 3;
+	replayOptions.keepMismatches = 1;
+	ReplayResult same = Replay(trace, [](const std::string& numbers) { return Add(numbers); }, replayOptions);
+	BOOST_CHECK(same.calls == 9 && same.mismatches == 0 && same.negatives == 3 && same.latency.Count() == 9);
+	ReplayResult wrong = Replay(trace, [](const std::string& numbers) { return numbers.find('-') == std::string::npos ? Add(numbers) + 1 : 0; }, replayOptions);
+	BOOST_CHECK(wrong.mismatches == 9 && wrong.examples.size() == 1 && wrong.examples[0].index == 0);
+	BOOST_CHECK(wrong.examples[0].expected.negative && !wrong.examples[0].got.negative);
+}
\ No newline at end of file
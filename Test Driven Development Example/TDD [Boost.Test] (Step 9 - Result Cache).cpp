@@ -0,0 +1,321 @@
+#define BOOST_TEST_MODULE AddStringTest
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "boost\test\unit_test.hpp"
+
+//An example of test driven development. Following code requirements from here:
+//https://technologyconversations.com/2013/12/20/test-driven-development-tdd-example-walkthrough/
+
+//1.
+//Create a simple String calculator with a method int Add(string numbers)
+//The method can take 0, 1 or 2 numbers, and will return their sum (for an empty string it will return 0) for example  or 1 or 1,2
+// - Added T StringToNumber() and the Add() function
+
+//2.
+//Allow the Add method to handle an unknown amount of numbers
+// - Removed the size check for the Add() function
+
+//3.
+//Allow the Add method to handle new lines between numbers (instead of commas).
+//The following input is ok : 1\n2, 3(will equal 6)
+// - No change needed
+
+//4.
+//Support different delimiters
+//To change a delimiter, the beginning of the string will contain a separate line that looks like this:
+//[delimiter]\n[numbers] for example ;\n1;2 should return three where the default delimiter is ;.
+//The first line is optional. All existing scenarios should still be supported
+// - Added explicit delimiter check, if none is supplied any non-digit is considered a delimiter
+
+//5.
+//Calling Add with a negative number will throw an exception negatives not allowed  and the negative that was passed.
+//If there are multiple negatives, show all of them in the exception message.
+// - Added NegativeNumberException and try catch block
+
+
+//6.
+//Numbers bigger than 1000 should be ignored, so adding 2 + 1001 = 2
+// - Added check in StringToNumber()
+
+//7.
+//Delimiters can be of any length with the following format: //[delimiter]\n for example: //[]\n123 should return 6
+// - Range-based for loop changed to be a standard for loop so we can keep track of the iterator and use it to find the delimiter substring
+//	 Added a check if we are using a single or multi character delimiter at the top of Add(). Multi character delims are then read in at the start of the for loop
+//	 Added a for loop once we encounter the first character of the user set delimiter. Checks if the full delimiter is there
+
+//8.
+//Allow multiple delimiters like this: //[delim1][delim2]\n for example //[-][%]\n1-2%3 should return 6.
+//Make sure you can also handle multiple delimiters with length longer than one char
+// - Changed the delimiter to a vector of delimiters
+//	 Moved code for checking delimiters in the string to a new function
+//	 Removed single character delimiters without []
+
+//9.
+//Cache the results of repeated inputs. The same strings arrive many times, so put an optional bounded cache in front of Add.
+//Negative numbers should be cached as well, and the cache should report its hit ratio and how many bytes it saved
+// - Added HashBytes() and the AddCache class, a sharded CLOCK cache keyed on a 64 bit hash and checked against the full string
+//	 Added the number to NegativeNumberException so a cached negative can be thrown again
+
+struct NegativeNumberException : public std::exception {
+	NegativeNumberException(const int& number) :number(number), msg("Negative numbers not allowed! (" + std::to_string(number) + ")") {}
+
+	virtual char const* what() const noexcept
+	{
+		return msg.c_str();
+	}
+
+	int number;	//the negative that was passed
+private:
+	std::string msg;
+};
+
+template <typename T>
+T StringToNumber(const std::string& s) {
+	std::stringstream ss(s);
+	T result = T();
+	ss >> result;
+	if (result < 0) throw NegativeNumberException(result);
+	if (result > 1000) result = 0;
+	return result;
+}
+
+bool CheckDelim(const std::string& delim, const std::string& numbers, std::string& substring, std::vector<int>& converted, int& i) {
+	if (numbers[i] == delim.front()) {	//character matches the start of users delim
+		for (int j = 0; j < delim.size(); ++j) {
+			if ((i + j) >= numbers.size() || numbers[i + j] != delim[j]) return false;	//we are at the end of the string or character doesn't match, delim not found
+		}
+		//we found users delim, get an int from the current substring
+		if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+		i += delim.size() - 1;	//now skip over the substring
+		return true;
+	}
+	else return false;
+}
+
+int Add(std::string numbers) {
+	std::vector<int> converted;
+	std::string substring = "";
+	int result = 0;
+
+	std::vector<std::string> delimiters;
+	bool usingDelim = false;
+	bool readingDelim = false;
+
+	if (numbers.size() && !isdigit(numbers.front())) {	//if numbers isn't empty, check the front for a delimiter // Step 4.
+		usingDelim = true;
+		readingDelim = true;
+		delimiters.push_back("");
+	}
+
+	for (int i = 0; i < numbers.size(); ++i) {
+		if (readingDelim) {
+			if (numbers[i] == '[') continue;	//skip this character
+			if (numbers[i] == ']') { //finished reading delim
+				if ((i + 1) < numbers.size() && numbers[i + 1] != '[') readingDelim = false;	//range check first, then if we don't find another delim declaration stop checking
+				else delimiters.push_back("");
+				continue; 
+			}	
+			delimiters[delimiters.size() - 1] += numbers[i];
+			continue;
+		}
+		
+		if (isdigit(numbers[i]) && !usingDelim) substring += numbers[i];	//check if user supplied a delim otherwise only check for digits // Step 4.
+		else if (usingDelim) {
+			bool foundDelim = false;
+			for (std::string delim : delimiters) {	//try each delim in the delim vector
+				if (CheckDelim(delim, numbers, substring, converted, i)) {
+					foundDelim = true; 
+					break;
+				}
+			}
+			if (!foundDelim) substring += numbers[i]; //didnt find delim, just add this character to the substring
+		}
+		else if (substring != "") {
+			converted.push_back(StringToNumber<int>(substring));
+			substring = "";
+		}
+	}
+	converted.push_back(StringToNumber<int>(substring));
+
+	for (int i : converted) result += i;
+	return result;
+}
+
+uint64_t HashBytes(const char* data, size_t size) {	//reads 8 bytes at a time, the tail is zero padded
+	const uint64_t k0 = 0x9E3779B97F4A7C15ULL, k1 = 0xC2B2AE3D27D4EB4FULL;
+	uint64_t h = k0 ^ (size * k1);
+	uint64_t word = 0;
+	size_t i = 0;
+	for (; i + 8 <= size; i += 8) {
+		std::memcpy(&word, data + i, 8);
+		h = (h ^ (word * k1)) * k0;
+		h ^= h >> 29;
+	}
+	word = 0;
+	std::memcpy(&word, data + i, size - i);
+	h = (h ^ (word * k1)) * k0;
+	h ^= h >> 32;	//final mix so the low bits depend on every input byte
+	h *= k1;
+	h ^= h >> 29;
+	return h;
+}
+
+struct CacheStats {
+	unsigned long long hits = 0;
+	unsigned long long misses = 0;
+	unsigned long long bytesSaved = 0;	//input bytes we didn't have to scan because of a hit
+	size_t entries = 0;
+
+	double HitRatio() const {
+		return (hits + misses) ? double(hits) / double(hits + misses) : 0.0;
+	}
+};
+
+class AddCache {
+public:
+	//capacity is the total number of cached strings, spread across the shards. Strings longer than maxKeySize skip the cache
+	AddCache(size_t capacity = 4096, size_t shardCount = 16, size_t maxKeySize = 4096) :maxKeySize(maxKeySize) {
+		if (shardCount == 0) shardCount = 1;
+		for (size_t i = 0; i < shardCount; ++i) {
+			shards.emplace_back(new Shard());
+			shards.back()->capacity = std::max<size_t>(1, capacity / shardCount);
+		}
+	}
+
+	int Add(const std::string& numbers) {
+		if (numbers.size() > maxKeySize) return ::Add(numbers);
+
+		uint64_t hash = HashBytes(numbers.data(), numbers.size());
+		Shard& shard = *shards[(hash >> 32) % shards.size()];
+		{
+			std::lock_guard<std::mutex> guard(shard.lock);
+			auto found = shard.index.find(hash);
+			if (found != shard.index.end() && shard.entries[found->second].key == numbers) {	//hash matched, check the full string before trusting it
+				Entry& entry = shard.entries[found->second];
+				entry.referenced = true;
+				++shard.stats.hits;
+				shard.stats.bytesSaved += numbers.size();
+				if (entry.negative) throw NegativeNumberException(entry.value);
+				return entry.value;
+			}
+			++shard.stats.misses;
+		}
+
+		//not cached, run Add without holding the lock so other threads on this shard aren't blocked
+		int value = 0;
+		bool negative = false;
+		try {
+			value = ::Add(numbers);
+		}
+		catch (NegativeNumberException& e) {
+			value = e.number;
+			negative = true;
+		}
+
+		{
+			std::lock_guard<std::mutex> guard(shard.lock);
+			Insert(shard, hash, numbers, value, negative);
+		}
+		if (negative) throw NegativeNumberException(value);
+		return value;
+	}
+
+	CacheStats Stats() const {
+		CacheStats total;
+		for (const std::unique_ptr<Shard>& shard : shards) {
+			std::lock_guard<std::mutex> guard(shard->lock);
+			total.hits += shard->stats.hits;
+			total.misses += shard->stats.misses;
+			total.bytesSaved += shard->stats.bytesSaved;
+			total.entries += shard->entries.size();
+		}
+		return total;
+	}
+
+private:
+	struct Entry {
+		uint64_t hash;
+		std::string key;
+		int value;	//the sum, or the negative number if negative is set
+		bool negative;
+		bool referenced;	//CLOCK bit, set on every hit and cleared as the hand passes
+	};
+
+	struct Shard {
+		mutable std::mutex lock;
+		std::vector<Entry> entries;
+		std::unordered_map<uint64_t, size_t> index;	//hash to position in entries
+		size_t hand = 0;
+		size_t capacity = 1;
+		CacheStats stats;
+	};
+
+	static void Insert(Shard& shard, uint64_t hash, const std::string& numbers, int value, bool negative) {
+		auto found = shard.index.find(hash);
+		size_t slot;
+		if (found != shard.index.end()) slot = found->second;	//already cached (another thread got here first) or a hash collision, overwrite it
+		else if (shard.entries.size() < shard.capacity) {
+			slot = shard.entries.size();
+			shard.entries.push_back(Entry());
+		}
+		else {
+			while (shard.entries[shard.hand].referenced) {	//give every referenced entry a second chance
+				shard.entries[shard.hand].referenced = false;
+				shard.hand = (shard.hand + 1) % shard.entries.size();
+			}
+			slot = shard.hand;
+			shard.hand = (shard.hand + 1) % shard.entries.size();
+			shard.index.erase(shard.entries[slot].hash);
+		}
+
+		Entry& entry = shard.entries[slot];
+		entry.hash = hash;
+		entry.key = numbers;
+		entry.value = value;
+		entry.negative = negative;
+		entry.referenced = false;	//new entries have to be hit once before they survive the hand, so one-off strings are evicted first
+		shard.index[hash] = slot;
+	}
+
+	std::vector<std::unique_ptr<Shard>> shards;
+	size_t maxKeySize;
+};
+
+BOOST_AUTO_TEST_CASE(test9) {
+	AddCache cache(4, 1);
+	BOOST_CHECK(cache.Add("1 2 3") == 6);
+	BOOST_CHECK(cache.Add("1 2 3") == 6);
+	BOOST_CHECK(cache.Add("[;]23;/4;;7") == 30);
+	BOOST_CHECK_THROW(cache.Add("[\n]3\n9\n-1"), NegativeNumberException);
+	BOOST_CHECK_THROW(cache.Add("[\n]3\n9\n-1"), NegativeNumberException);	//the negative is cached too
+
+	CacheStats stats = cache.Stats();
+	BOOST_CHECK(stats.hits == 2);
+	BOOST_CHECK(stats.misses == 3);
+	BOOST_CHECK(stats.bytesSaved == 5 + 9);
+
+	for (int i = 0; i < 100; ++i) BOOST_CHECK(cache.Add(std::to_string(i) + ",1") == i + 1);
+	BOOST_CHECK(cache.Stats().entries == 4);	//bounded by the capacity
+	BOOST_CHECK(cache.Add("[,,][..]1..2,,3") == Add("[,,][..]1..2,,3"));
+}
+
+BOOST_AUTO_TEST_CASE(test9_hash) {
+	std::string a = "[;]1;2;3;4;5;6;7;8;9";
+	std::string b = a;
+	b[b.size() - 1] = '8';
+	BOOST_CHECK(HashBytes(a.data(), a.size()) == HashBytes(a.data(), a.size()));
+	BOOST_CHECK(HashBytes(a.data(), a.size()) != HashBytes(b.data(), b.size()));
+	BOOST_CHECK(HashBytes("1", 1) != HashBytes("1\0", 2));	//length is part of the hash
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+
+// C interface to the string calculator, see TDD (Step 26 - C ABI).cpp. Build it as a shared library with STRINGCALC_LIBRARY defined,
+// for example: g++ -std=c++14 -O2 -shared -fPIC -fvisibility=hidden -DSTRINGCALC_LIBRARY "TDD (Step 26 - C ABI).cpp" -o libstringcalc.so
+//
+// Nothing is copied and nothing is thrown. Inputs are read where they are as (pointer, length) and every call returns a status.
+// A context holds state that is reused between calls. It may be used by one thread at a time, so give each thread its own.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32) && defined(STRINGCALC_LIBRARY)
+#define STRINGCALC_API __declspec(dllexport)
+#elif defined(_WIN32)
+#define STRINGCALC_API __declspec(dllimport)
+#elif defined(__GNUC__)
+#define STRINGCALC_API __attribute__((visibility("default")))
+#else
+#define STRINGCALC_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STRINGCALC_ABI_VERSION 1
+
+typedef enum stringcalc_status {
+	STRINGCALC_OK = 0,
+	STRINGCALC_NEGATIVE = 1,	// the input has a negative number, the value is the first one
+	STRINGCALC_INVALID_ARGUMENT = 2,	// a null pointer where one isn't allowed
+	STRINGCALC_OUT_OF_MEMORY = 3,
+	STRINGCALC_INTERNAL_ERROR = 4
+} stringcalc_status;
+
+typedef struct stringcalc_context stringcalc_context;
+
+typedef struct stringcalc_buffer {
+	const char* data;	// may be null when size is 0
+	size_t size;
+} stringcalc_buffer;
+
+typedef struct stringcalc_result {
+	int32_t status;	// a stringcalc_status
+	int32_t value;	// the sum, or the negative when status is STRINGCALC_NEGATIVE
+} stringcalc_result;
+
+STRINGCALC_API uint32_t stringcalc_abi_version(void);	// STRINGCALC_ABI_VERSION of the library that was loaded
+
+STRINGCALC_API stringcalc_status stringcalc_context_create(stringcalc_context** context);
+STRINGCALC_API void stringcalc_context_destroy(stringcalc_context* context);	// null is allowed
+
+// Same result as Add(). value gets the sum, or the negative when STRINGCALC_NEGATIVE is returned
+STRINGCALC_API stringcalc_status stringcalc_add(stringcalc_context* context, const char* data, size_t size, int32_t* value);
+
+// Adds count inputs into count results, each result has its own status. The call itself only fails if inputs or results is null
+STRINGCALC_API stringcalc_status stringcalc_add_batch(stringcalc_context* context, const stringcalc_buffer* inputs, size_t count, stringcalc_result* results);
+
+STRINGCALC_API const char* stringcalc_status_message(stringcalc_status status);	// a static string
+STRINGCALC_API const char* stringcalc_last_error(const stringcalc_context* context);	// message from the last failed call on context, "" if none. Valid until the next call
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file